@@ -0,0 +1,212 @@
+#!/usr/bin/env python3
+
+# Run the benchglk workloads and report how fast RemGlk handles them.
+#
+#   python3 bench.py [options] [workload ...]
+#
+# "make bench" builds benchglk and runs this with the defaults. Each
+# workload is run several times. The script plays the client: it sends
+# the init event, reads each update, and answers with a line input (or
+# a hyperlink click, in the links workload).
+#
+# For each workload we report turns per second, output bytes per turn,
+# and peak RSS. Turns per second is computed from the user+system CPU
+# time of the benchglk process, not wall-clock time, so the time this
+# script spends parsing JSON doesn't count, and a busy machine perturbs
+# the numbers less. The median of the runs is reported.
+#
+# Peak RSS is read from /proc (VmHWM) while benchglk waits for input.
+# The ru_maxrss figure from wait4() is no good here, because on Linux
+# it includes the memory of this script, which the child inherits
+# before it execs. Without /proc, we fall back on it anyway.
+#
+# To gate regressions, save the results of a known-good build with
+# --json, and then run later builds with --baseline. The script exits
+# with status 1 if throughput drops, or output size or RSS grows, by
+# more than the tolerance.
+
+import sys
+import os
+import json
+import optparse
+import subprocess
+import time
+
+WORKLOADS = [ 'prose', 'status', 'links', 'graphics', 'input' ]
+
+popt = optparse.OptionParser(usage='bench.py [options] [workload ...]')
+popt.add_option('--prog', action='store', dest='prog', default='./benchglk',
+                help='workload program (default ./benchglk)')
+popt.add_option('--turns', action='store', type=int, dest='turns', default=2000,
+                help='turns per run (default 2000)')
+popt.add_option('--repeat', action='store', type=int, dest='repeat', default=5,
+                help='runs per workload (default 5)')
+popt.add_option('--json', action='store', dest='jsonpath',
+                help='write the results to this file')
+popt.add_option('--baseline', action='store', dest='baseline',
+                help='compare against results saved with --json')
+popt.add_option('--tolerance', action='store', type=float, dest='tolerance', default=10.0,
+                help='allowed change from the baseline, in percent (default 10)')
+
+(opts, args) = popt.parse_args()
+
+# A long input line, with some non-ASCII characters to exercise the
+# UTF-8 and escape handling.
+LONGINPUT = ' '.join([ 'take the %dé lantern “quickly”' % (ix,) for ix in range(100) ])
+
+class BenchError(Exception):
+    pass
+
+def read_stanza(proc):
+    """Read one JSON update, which is terminated by a blank line. Return
+    (update, byte count), or (None, 0) at end of file."""
+    lines = []
+    count = 0
+    while True:
+        ln = proc.stdout.readline()
+        if not ln:
+            if lines:
+                raise BenchError('output ended in mid-update')
+            return (None, 0)
+        count += len(ln)
+        if not ln.strip():
+            if lines:
+                break
+            continue
+        lines.append(ln)
+    return (json.loads(b''.join(lines)), count)
+
+def peak_rss(pid):
+    """Return the peak RSS of a running process, in kilobytes, or None
+    if we can't find out."""
+    try:
+        with open('/proc/%d/status' % (pid,)) as fl:
+            for ln in fl:
+                if ln.startswith('VmHWM:'):
+                    return int(ln.split()[1])
+    except (IOError, ValueError):
+        pass
+    return None
+
+def send(proc, obj):
+    proc.stdin.write(json.dumps(obj).encode() + b'\n')
+    proc.stdin.flush()
+
+def run_once(workload):
+    """Run one workload to completion. Return a dict of results."""
+    proc = subprocess.Popen([ opts.prog, '-turns', str(opts.turns), workload ],
+                            stdin=subprocess.PIPE, stdout=subprocess.PIPE)
+    starttime = time.monotonic()
+    send(proc, { 'type':'init', 'gen':0,
+                 'metrics': { 'width':800, 'height':600, 'charwidth':10, 'charheight':20 },
+                 'support': [ 'hyperlinks', 'graphics', 'graphicswin' ] })
+
+    turns = 0
+    outbytes = 0
+    peakrss = None
+    try:
+        while True:
+            (update, count) = read_stanza(proc)
+            if update is None:
+                break
+            outbytes += count
+            if update.get('type') == 'error':
+                raise BenchError('%s: %s' % (workload, update.get('message')))
+            inputs = update.get('input')
+            if update.get('exit') or not inputs:
+                break
+            rss = peak_rss(proc.pid)
+            if rss is not None:
+                peakrss = max(rss, peakrss or 0)
+            req = inputs[0]
+            if req.get('hyperlink') and (turns & 1):
+                send(proc, { 'type':'hyperlink', 'gen':update['gen'],
+                             'window':req['id'], 'value':1 + (turns % 200) })
+            else:
+                value = (LONGINPUT if workload == 'input' else 'look')
+                send(proc, { 'type':'line', 'gen':update['gen'],
+                             'window':req['id'], 'value':value })
+            turns += 1
+    finally:
+        proc.stdin.close()
+        (pid, status, usage) = os.wait4(proc.pid, 0)
+        proc.returncode = status
+        proc.stdout.close()
+
+    walltime = time.monotonic() - starttime
+    if turns != opts.turns:
+        raise BenchError('%s: expected %d turns, got %d' % (workload, opts.turns, turns))
+
+    cputime = usage.ru_utime + usage.ru_stime
+    return {
+        'turnspersec': turns / max(cputime, 1.0e-6),
+        'bytesperturn': outbytes / turns,
+        'peakrss': (peakrss if peakrss is not None else usage.ru_maxrss),
+        'cpu': cputime,
+        'wall': walltime,
+    }
+
+def median(vals):
+    vals = sorted(vals)
+    return vals[len(vals) // 2]
+
+def run_workload(workload):
+    runs = [ run_once(workload) for ix in range(opts.repeat) ]
+    res = {}
+    for key in runs[0]:
+        res[key] = median([ run[key] for run in runs ])
+    # The spread of the throughput figures, as a rough guide to how much
+    # noise there is.
+    rates = [ run['turnspersec'] for run in runs ]
+    res['spread'] = 100.0 * (max(rates) - min(rates)) / res['turnspersec']
+    return res
+
+def compare(results, baseline):
+    """Check the results against a baseline. Return a list of problems."""
+    problems = []
+    tol = opts.tolerance / 100.0
+    for (workload, res) in results.items():
+        base = baseline.get(workload)
+        if not base:
+            continue
+        if res['turnspersec'] < base['turnspersec'] * (1.0 - tol):
+            problems.append('%s: turns/sec fell from %.1f to %.1f' % (workload, base['turnspersec'], res['turnspersec']))
+        if res['bytesperturn'] > base['bytesperturn'] * (1.0 + tol):
+            problems.append('%s: bytes/turn rose from %.0f to %.0f' % (workload, base['bytesperturn'], res['bytesperturn']))
+        if res['peakrss'] > base['peakrss'] * (1.0 + tol):
+            problems.append('%s: peak RSS rose from %d to %d KB' % (workload, base['peakrss'], res['peakrss']))
+    return problems
+
+workloads = args or WORKLOADS
+for workload in workloads:
+    if workload not in WORKLOADS:
+        popt.error('unknown workload: ' + workload)
+
+results = {}
+print('%-10s %10s %8s %12s %10s %8s' % ('workload', 'turns/sec', 'spread', 'bytes/turn', 'peak RSS', 'wall'))
+try:
+    for workload in workloads:
+        res = run_workload(workload)
+        results[workload] = res
+        print('%-10s %10.1f %7.1f%% %12.0f %7d KB %7.2fs' % (workload, res['turnspersec'], res['spread'], res['bytesperturn'], res['peakrss'], res['wall']))
+        sys.stdout.flush()
+except BenchError as ex:
+    print('bench.py: ' + str(ex), file=sys.stderr)
+    sys.exit(2)
+
+if opts.jsonpath:
+    with open(opts.jsonpath, 'w') as fl:
+        json.dump({ 'turns':opts.turns, 'results':results }, fl, indent=2)
+        fl.write('\n')
+
+if opts.baseline:
+    with open(opts.baseline) as fl:
+        baseline = json.load(fl)
+    if baseline.get('turns') != opts.turns:
+        print('bench.py: baseline was run with %s turns' % (baseline.get('turns'),), file=sys.stderr)
+        sys.exit(2)
+    problems = compare(results, baseline['results'])
+    for msg in problems:
+        print('REGRESSION: ' + msg)
+    if problems:
+        sys.exit(1)
@@ -0,0 +1,130 @@
+/* benchdispa.c: Benchmark for the Glk dispatch layer.
+
+    This program times a run of put_char and set_style calls, made
+    through gidispatch_call() one at a time (with and without checking
+    each call's prototype first) and then through gidispatch_call_batch(),
+    which does the checking itself. Output goes to a memory stream, so what's
+    measured is the dispatch layer and not the display.
+
+    Build it with "make benchdispa" and run it as
+        ./benchdispa -fm < /dev/null
+    The results are printed on stderr, since stdout carries RemGlk's
+    JSON output.
+*/
+
+#include <stdio.h>
+#include <time.h>
+#include "glk.h"
+#include "glkstart.h"
+#include "gi_dispa.h"
+
+glkunix_argumentlist_t glkunix_arguments[] = {
+    { NULL, glkunix_arg_End, NULL }
+};
+
+int glkunix_startup_code(glkunix_startup_t *data)
+{
+    return TRUE;
+}
+
+#define NUMCALLS (4000000)
+#define BATCHSIZE (64)
+
+/* Every eighth call is a style change. */
+#define CALL_IS_STYLE(ix) (((ix) & 7) == 7)
+
+static char membuf[256];
+
+static double elapsed(clock_t start)
+{
+    return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
+
+static void report(char *label, double secs)
+{
+    fprintf(stderr, "%-10s %8.3f s  %6.2f ns/call\n", label, secs,
+        secs * 1.0e9 / NUMCALLS);
+}
+
+void glk_main(void)
+{
+    strid_t str;
+    gluniversal_t args[BATCHSIZE];
+    gidispatch_batch_t calls[BATCHSIZE];
+    clock_t start;
+    glui32 ix, jx, done;
+
+    str = glk_stream_open_memory(membuf, sizeof(membuf), filemode_Write, 0);
+    glk_stream_set_current(str);
+
+    start = clock();
+    for (ix=0; ix<NUMCALLS; ix++) {
+        if (CALL_IS_STYLE(ix)) {
+            args[0].uint = (ix >> 3) & 1;
+            gidispatch_call(0x0086, 1, args); /* set_style */
+        }
+        else {
+            args[0].uch = 'a' + (ix & 15);
+            gidispatch_call(0x0080, 1, args); /* put_char */
+        }
+        if ((ix & 0xFF) == 0xFF)
+            glk_stream_set_position(str, 0, seekmode_Start);
+    }
+    report("single", elapsed(start));
+
+    /* The same, but looking up each call's prototype and checking its
+        arguments, as a VM must do before making a call for the game. */
+    start = clock();
+    for (ix=0; ix<NUMCALLS; ix++) {
+        glui32 funcnum;
+        gidispatch_protodesc_t *desc;
+        if (CALL_IS_STYLE(ix)) {
+            funcnum = 0x0086; /* set_style */
+            args[0].uint = (ix >> 3) & 1;
+        }
+        else {
+            funcnum = 0x0080; /* put_char */
+            args[0].uch = 'a' + (ix & 15);
+        }
+        desc = gidispatch_get_protodesc(funcnum);
+        if (!desc || desc->minslots > 1) {
+            fprintf(stderr, "bad prototype for call %d\n", (int)ix);
+            break;
+        }
+        gidispatch_call(funcnum, 1, args);
+        if ((ix & 0xFF) == 0xFF)
+            glk_stream_set_position(str, 0, seekmode_Start);
+    }
+    report("checked", elapsed(start));
+
+    /* The batch is set up once, the way a VM would compile a run of
+        calls; only the arguments change each time. (BATCHSIZE is a
+        multiple of 8, so the pattern of calls is the same in every
+        batch.) */
+    for (jx=0; jx<BATCHSIZE; jx++) {
+        calls[jx].argpos = jx;
+        calls[jx].numargs = 1;
+        calls[jx].funcnum = (CALL_IS_STYLE(jx) ? 0x0086 : 0x0080);
+    }
+
+    start = clock();
+    for (ix=0; ix<NUMCALLS; ix+=BATCHSIZE) {
+        for (jx=0; jx<BATCHSIZE; jx++) {
+            glui32 num = ix+jx;
+            if (CALL_IS_STYLE(num))
+                args[jx].uint = (num >> 3) & 1;
+            else
+                args[jx].uch = 'a' + (num & 15);
+        }
+        done = gidispatch_call_batch(BATCHSIZE, calls, args);
+        if (done != BATCHSIZE) {
+            fprintf(stderr, "batch stopped at call %d\n", (int)done);
+            break;
+        }
+        if ((ix & 0xFF) == 0xC0)
+            glk_stream_set_position(str, 0, seekmode_Start);
+    }
+    report("batch", elapsed(start));
+
+    glk_stream_close(str, NULL);
+}
@@ -0,0 +1,333 @@
+/* benchglk.c: Synthetic workloads for benchmarking RemGlk.
+
+    This program runs one of several artificial "games", each of which
+    stresses a different part of the library:
+
+        prose     a long dump of styled text into a buffer window each turn
+        status    a full redraw of a 24-line grid window each turn
+        links     a couple of hundred hyperlinks each turn
+        graphics  images and rectangles in a graphics window, plus images
+                  in the buffer window
+        input     very long line inputs, echoed back
+
+    Every turn ends with a line input request in the story window. The
+    game is not meant to be played by hand; bench.py drives it and
+    measures the results. Build and run the whole suite with "make bench".
+    To run one workload:
+        ./benchglk -turns 200 prose
+    The text is generated from a fixed seed, so every run of a workload
+    produces the same output (apart from window ids).
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "glk.h"
+#include "glkstart.h"
+#include "gi_blorb.h"
+
+glkunix_argumentlist_t glkunix_arguments[] = {
+    { "-turns", glkunix_arg_NumberValue, "-turns NUM: Number of turns to run (default 100)" },
+    { "", glkunix_arg_ValueFollows, "workload: prose, status, links, graphics, or input" },
+    { NULL, glkunix_arg_End, NULL }
+};
+
+typedef enum workload_enum {
+    work_Prose, work_Status, work_Links, work_Graphics, work_Input,
+} workload_t;
+
+static workload_t workload = work_Prose;
+static int numturns = 100;
+
+int glkunix_startup_code(glkunix_startup_t *data)
+{
+    int ix;
+    char *name = NULL;
+
+    for (ix=1; ix<data->argc; ix++) {
+        if (!strcmp(data->argv[ix], "-turns") && ix+1 < data->argc) {
+            ix++;
+            numturns = atoi(data->argv[ix]);
+        }
+        else if (data->argv[ix][0] != '-') {
+            name = data->argv[ix];
+        }
+    }
+
+    if (!name || !strcmp(name, "prose"))
+        workload = work_Prose;
+    else if (!strcmp(name, "status"))
+        workload = work_Status;
+    else if (!strcmp(name, "links"))
+        workload = work_Links;
+    else if (!strcmp(name, "graphics"))
+        workload = work_Graphics;
+    else if (!strcmp(name, "input"))
+        workload = work_Input;
+    else
+        return FALSE;
+
+    return (numturns > 0);
+}
+
+static winid_t mainwin = NULL;
+static winid_t statuswin = NULL;
+static winid_t graphwin = NULL;
+
+/* A little linear congruential generator, so that the output doesn't
+   depend on the C library. */
+static glui32 seed = 12345;
+
+static glui32 bench_random(glui32 range)
+{
+    seed = seed * 1103515245 + 12345;
+    return ((seed >> 16) & 0x7FFF) % range;
+}
+
+static char *wordlist[] = {
+    "the", "a", "of", "lantern", "passage", "brass", "door", "north",
+    "you", "see", "here", "is", "an", "old", "dusty", "mailbox",
+    "leaflet", "small", "white", "house", "forest", "path", "leads",
+    "into", "darkness", "grue", "sword", "glows", "faintly", "blue",
+    "and", "with", "caf\351", "na\357ve", "fa\347ade", "d\351j\340", "vu",
+};
+#define NUMWORDS (sizeof(wordlist) / sizeof(char *))
+
+static void print_words(int count)
+{
+    int ix;
+    for (ix=0; ix<count; ix++) {
+        if (ix)
+            glk_put_char(' ');
+        glk_put_string(wordlist[bench_random(NUMWORDS)]);
+    }
+}
+
+/* About 8 kilobytes of text, in paragraphs, with an emphasized phrase
+   now and then. */
+static void turn_prose(int turn)
+{
+    int para, sent;
+    char buf[32];
+
+    snprintf(buf, sizeof(buf), "Turn %d\n", turn);
+    glk_set_style(style_Subheader);
+    glk_put_string(buf);
+    glk_set_style(style_Normal);
+
+    for (para=0; para<12; para++) {
+        for (sent=0; sent<6; sent++) {
+            print_words(3 + bench_random(6));
+            glk_put_char(' ');
+            glk_set_style(style_Emphasized);
+            print_words(2);
+            glk_set_style(style_Normal);
+            glk_put_char(' ');
+            print_words(4 + bench_random(8));
+            glk_put_string(". ");
+        }
+        glk_put_string("\n\n");
+    }
+}
+
+/* Rewrite every cell of the status grid. A counter in each line makes
+   sure that every line really changes. */
+static void turn_status(int turn)
+{
+    glui32 width, height, row;
+    char buf[32];
+
+    glk_window_get_size(statuswin, &width, &height);
+    glk_set_window(statuswin);
+    glk_window_clear(statuswin);
+
+    for (row=0; row<height; row++) {
+        glk_window_move_cursor(statuswin, 0, row);
+        glk_set_style((row & 1) ? style_Normal : style_Alert);
+        snprintf(buf, sizeof(buf), "%3d:%-5d ", (int)row, turn);
+        glk_put_string(buf);
+        print_words(width / 6);
+    }
+
+    glk_set_window(mainwin);
+    glk_put_string("Time passes.\n");
+}
+
+/* A list of objects, every one a hyperlink. */
+static void turn_links(int turn)
+{
+    int ix;
+
+    glk_put_string("You can see ");
+    for (ix=0; ix<200; ix++) {
+        glk_set_hyperlink(ix+1);
+        print_words(1 + bench_random(3));
+        glk_set_hyperlink(0);
+        glk_put_string((ix+1 < 200) ? ", " : ".\n");
+    }
+    glk_request_hyperlink_event(mainwin);
+}
+
+/* The graphics workload needs a resource map with some images in it.
+   We build a Blorb file in memory, containing PNG chunks which are
+   only long enough for the library to find their dimensions. */
+
+#define NUMIMAGES (16)
+#define PNGLEN (33)
+#define BLORBLEN (12 + (8 + 4 + 12*NUMIMAGES) + NUMIMAGES*(8 + PNGLEN + 1))
+
+static unsigned char blorbdata[BLORBLEN];
+
+static unsigned char *write4(unsigned char *ptr, glui32 val)
+{
+    ptr[0] = (val >> 24) & 0xFF;
+    ptr[1] = (val >> 16) & 0xFF;
+    ptr[2] = (val >> 8) & 0xFF;
+    ptr[3] = val & 0xFF;
+    return ptr+4;
+}
+
+static unsigned char *writeid(unsigned char *ptr, char *id)
+{
+    memcpy(ptr, id, 4);
+    return ptr+4;
+}
+
+static void build_blorb()
+{
+    static unsigned char pngsig[8] = { 0x89, 'P', 'N', 'G', 0x0D, 0x0A, 0x1A, 0x0A };
+    unsigned char *ptr = blorbdata;
+    glui32 pos;
+    int ix;
+
+    memset(blorbdata, 0, sizeof(blorbdata));
+    ptr = writeid(ptr, "FORM");
+    ptr = write4(ptr, BLORBLEN-8);
+    ptr = writeid(ptr, "IFRS");
+
+    ptr = writeid(ptr, "RIdx");
+    ptr = write4(ptr, 4 + 12*NUMIMAGES);
+    ptr = write4(ptr, NUMIMAGES);
+    pos = 12 + (8 + 4 + 12*NUMIMAGES);
+    for (ix=0; ix<NUMIMAGES; ix++) {
+        ptr = writeid(ptr, "Pict");
+        ptr = write4(ptr, ix+1);
+        ptr = write4(ptr, pos);
+        pos += (8 + PNGLEN + 1); /* chunks are padded to even lengths */
+    }
+
+    for (ix=0; ix<NUMIMAGES; ix++) {
+        unsigned char *chunk = ptr;
+        ptr = writeid(ptr, "PNG ");
+        ptr = write4(ptr, PNGLEN);
+        memcpy(ptr, pngsig, 8);
+        ptr += 8;
+        ptr = write4(ptr, 13);
+        ptr = writeid(ptr, "IHDR");
+        ptr = write4(ptr, 16 + 8*ix);
+        ptr = write4(ptr, 16 + 4*ix);
+        /* depth, color type, etc, and the CRC, are left as zero. */
+        ptr = chunk + (8 + PNGLEN + 1);
+    }
+}
+
+static void turn_graphics(int turn)
+{
+    glui32 width, height;
+    int ix;
+
+    glk_window_get_size(graphwin, &width, &height);
+    if (width < 64 || height < 64)
+        width = height = 64;
+
+    glk_window_clear(graphwin);
+    for (ix=0; ix<40; ix++) {
+        glui32 color = (bench_random(256) << 16) | (bench_random(256) << 8)
+            | bench_random(256);
+        glk_window_fill_rect(graphwin, color,
+            bench_random(width), bench_random(height),
+            1+bench_random(64), 1+bench_random(64));
+    }
+    for (ix=0; ix<40; ix++) {
+        glk_image_draw(graphwin, 1+bench_random(NUMIMAGES),
+            bench_random(width), bench_random(height));
+    }
+
+    for (ix=0; ix<8; ix++) {
+        glk_image_draw(mainwin, 1+bench_random(NUMIMAGES),
+            imagealign_InlineUp, 0);
+        glk_put_char(' ');
+        print_words(6);
+        glk_put_char('\n');
+    }
+}
+
+#define INPUTLEN (4096)
+static glui32 inputbuf[INPUTLEN];
+
+void glk_main(void)
+{
+    strid_t blorbstr;
+    event_t ev;
+    int turn;
+
+    mainwin = glk_window_open(0, 0, 0, wintype_TextBuffer, 1);
+    if (!mainwin)
+        return;
+
+    if (workload == work_Status) {
+        statuswin = glk_window_open(mainwin,
+            winmethod_Above | winmethod_Fixed, 24, wintype_TextGrid, 2);
+        if (!statuswin)
+            return;
+    }
+    if (workload == work_Graphics) {
+        build_blorb();
+        blorbstr = glk_stream_open_memory((char *)blorbdata, sizeof(blorbdata),
+            filemode_Read, 0);
+        if (giblorb_set_resource_map(blorbstr))
+            return;
+        graphwin = glk_window_open(mainwin,
+            winmethod_Above | winmethod_Proportional, 50, wintype_Graphics, 3);
+        if (!graphwin)
+            return;
+    }
+
+    glk_set_window(mainwin);
+
+    for (turn=0; turn<numturns; turn++) {
+        switch (workload) {
+            case work_Prose:
+                turn_prose(turn);
+                break;
+            case work_Status:
+                turn_status(turn);
+                break;
+            case work_Links:
+                turn_links(turn);
+                break;
+            case work_Graphics:
+                turn_graphics(turn);
+                break;
+            case work_Input:
+                break;
+        }
+
+        glk_put_string("\n>");
+        glk_request_line_event_uni(mainwin, inputbuf, INPUTLEN, 0);
+
+        do {
+            glk_select(&ev);
+        } while (ev.type != evtype_LineInput && ev.type != evtype_Hyperlink);
+
+        if (ev.type == evtype_Hyperlink) {
+            glk_cancel_line_event(mainwin, NULL);
+            glk_put_string("You pick it up.\n");
+        }
+        else if (workload == work_Input) {
+            glk_put_string("You said: ");
+            glk_put_buffer_uni(inputbuf, ev.val1);
+            glk_put_char('\n');
+        }
+    }
+}
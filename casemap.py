@@ -0,0 +1,269 @@
+#!/usr/bin/env python3
+
+# Generate cgunigen.c, the Unicode tables used by cgunicod.c.
+#
+#   python3 casemap.py > cgunigen.c
+#
+# The data comes from Python's unicodedata module (and the str case
+# methods, which follow SpecialCasing.txt), so the tables match the
+# Unicode version of the Python that runs this script.
+#
+# Case, combining class, and decomposition are two-stage tables: a page
+# array indexed by (ch >> 8) picks a 256-entry block, which is indexed by
+# (ch & 0xFF). Identical blocks are stored once. Composition pairs go in
+# an open-addressed hash table.
+
+import unicodedata
+
+NUMPAGES = 0x1100   # covers U+0000 to U+10FFFF
+LIMIT = NUMPAGES * 256
+
+def canon_decomp(ch):
+    """Return the full canonical decomposition of ch, as a list of
+    code points, or None if it has none. Hangul syllables are left
+    alone, as they decompose algorithmically and are not listed in
+    the Unicode data file."""
+    dec = unicodedata.decomposition(chr(ch))
+    if not dec or dec.startswith('<'):
+        return None
+    res = []
+    for val in dec.split():
+        sub = canon_decomp(int(val, 16))
+        if sub:
+            res.extend(sub)
+        else:
+            res.append(int(val, 16))
+    return res
+
+def case_maps(ch):
+    """Return the full (upper, lower, title) mappings of ch, as lists
+    of code points."""
+    st = chr(ch)
+    return ([ ord(c) for c in st.upper() ],
+            [ ord(c) for c in st.lower() ],
+            [ ord(c) for c in st.title() ])
+
+# Gather the raw data.
+
+casemap = {}      # ch -> (upper, lower) simple mapping, or None if special
+specials = {}     # ch -> (upper, lower, title) lists
+combining = {}    # ch -> class
+decomps = {}      # ch -> list
+compositions = {} # (ch1, ch2) -> ch
+
+for ch in range(LIMIT):
+    if 0xD800 <= ch < 0xE000:
+        continue
+    (upper, lower, title) = case_maps(ch)
+    if upper != [ch] or lower != [ch] or title != [ch]:
+        if len(upper) == 1 and len(lower) == 1 and title == upper:
+            casemap[ch] = (upper[0], lower[0])
+        else:
+            casemap[ch] = None
+            specials[ch] = (upper, lower, title)
+
+    cls = unicodedata.combining(chr(ch))
+    if cls:
+        combining[ch] = cls
+
+    dec = canon_decomp(ch)
+    if dec:
+        decomps[ch] = dec
+        # A primary composite is a canonical pair which NFC puts back
+        # together. That test leaves out the composition exclusions,
+        # singletons, and non-starter decompositions.
+        raw = unicodedata.decomposition(chr(ch)).split()
+        if len(raw) == 2 and unicodedata.normalize('NFC', chr(ch)) == chr(ch):
+            pair = (int(raw[0], 16), int(raw[1], 16))
+            compositions[pair] = ch
+
+# Output helpers.
+
+def build_pages(func, default):
+    """Build a list of 256-entry blocks and a page array, with identical
+    blocks shared. Block 0 is all default values. func(ch) returns the
+    entry for ch."""
+    blocks = [ tuple([default] * 256) ]
+    index = { blocks[0]: 0 }
+    pages = []
+    for page in range(NUMPAGES):
+        block = tuple([ func(page*256 + ix) for ix in range(256) ])
+        if block not in index:
+            index[block] = len(blocks)
+            blocks.append(block)
+        pages.append(index[block])
+    return (pages, blocks)
+
+def print_array(ctype, name, vals, fmt, perline):
+    print('static %s %s[%d] = {' % (ctype, name, len(vals)))
+    for pos in range(0, len(vals), perline):
+        print('    ' + ' '.join([ (fmt % val)+',' for val in vals[pos:pos+perline] ]))
+    print('};')
+    print()
+
+print('/* This file was generated by casemap.py. */')
+print('/* Derived from Unicode data files, Unicode version %s. */' % (unicodedata.unidata_version,))
+print('/* This does not get compiled into a cgunigen.o file; it\'s')
+print(' * #included in cgunicod.c. */')
+print()
+print('/* All the per-character tables are two-stage. unigen_X_page[ch >> 8]')
+print('   gives a block number, and the block is indexed by (ch & 0xFF). */')
+print('#define UNIGEN_LIMIT (0x%x)' % (LIMIT,))
+print()
+
+# Case tables. Block 0 means "no case changes in this page". In the other
+# blocks, an entry of (0xFFFFFFFF, 0xFFFFFFFF) means "look in the special
+# table".
+
+def case_entry(ch):
+    if ch not in casemap:
+        return (ch, ch)
+    val = casemap[ch]
+    if val is None:
+        return (0xFFFFFFFF, 0xFFFFFFFF)
+    return val
+
+casepages = [ 0 ] * NUMPAGES
+caseblocks = []
+for page in range(NUMPAGES):
+    if not any((page*256 + ix) in casemap for ix in range(256)):
+        continue
+    caseblocks.append([ case_entry(page*256 + ix) for ix in range(256) ])
+    casepages[page] = len(caseblocks)
+
+print_array('unsigned char', 'unigen_case_page', casepages, '%d', 32)
+print('static gli_case_block_t unigen_case_blocks[%d][256] = {' % (len(caseblocks),))
+for block in caseblocks:
+    print('  {')
+    for pos in range(0, 256, 4):
+        print('    ' + ' '.join([ '{ 0x%x, 0x%x },' % val for val in block[pos:pos+4] ]))
+    print('  },')
+print('};')
+print()
+
+specialarray = []
+speciallist = []
+for ch in sorted(specials):
+    offsets = []
+    for seq in specials[ch]:
+        offsets.append(len(specialarray))
+        specialarray.append(len(seq))
+        specialarray.extend(seq)
+    speciallist.append((ch, offsets))
+
+print_array('glui32', 'unigen_special_array', specialarray, '0x%x', 12)
+print('/* Sorted by character, for binary search. */')
+print_array('glui32', 'unigen_special_chars', [ ch for (ch, offsets) in speciallist ], '0x%x', 10)
+print('static gli_case_special_t unigen_special_offsets[%d] = {' % (len(speciallist),))
+for (ch, offsets) in speciallist:
+    print('    { %d, %d, %d },  /* 0x%x */' % (offsets[0], offsets[1], offsets[2], ch))
+print('};')
+print()
+
+# Combining classes.
+
+(pages, blocks) = build_pages(lambda ch: combining.get(ch, 0), 0)
+print_array('unsigned char', 'unigen_combining_page', pages, '%d', 32)
+print('static unsigned char unigen_combining_blocks[%d][256] = {' % (len(blocks),))
+for block in blocks:
+    print('  {')
+    for pos in range(0, 256, 32):
+        print('    ' + ' '.join([ '%d,' % val for val in block[pos:pos+32] ]))
+    print('  },')
+print('};')
+print()
+
+# Decompositions. unigen_decomp_data holds, for each decomposable
+# character, a count followed by that many characters. Block entries are
+# offsets into it; offset zero is a dummy entry with count zero.
+
+decompdata = [ 0 ]
+decompoffset = {}
+for ch in sorted(decomps):
+    decompoffset[ch] = len(decompdata)
+    decompdata.append(len(decomps[ch]))
+    decompdata.extend(decomps[ch])
+if len(decompdata) >= 0x10000:
+    raise Exception('decomposition data too large for 16-bit offsets')
+
+(pages, blocks) = build_pages(lambda ch: decompoffset.get(ch, 0), 0)
+print_array('glui32', 'unigen_decomp_data', decompdata, '0x%x', 10)
+print_array('unsigned char', 'unigen_decomp_page', pages, '%d', 32)
+print('static unsigned short unigen_decomp_blocks[%d][256] = {' % (len(blocks),))
+for block in blocks:
+    print('  {')
+    for pos in range(0, 256, 16):
+        print('    ' + ' '.join([ '%d,' % val for val in block[pos:pos+16] ]))
+    print('  },')
+print('};')
+print()
+
+# Normalization quick-check flags, as in the NFD_QC and NFC_QC properties,
+# but computed from the tables above so that they agree with what
+# cgunicod.c actually does. (In particular, Hangul is not decomposed or
+# composed, so the conjoining jamo are not "maybe".)
+
+composites = set(compositions.values())
+secondchars = set(ch2 for (ch1, ch2) in compositions)
+
+def qc_entry(ch):
+    val = 0
+    if ch in decomps:
+        val |= 1
+        if ch not in composites:
+            val |= 2
+    if ch in secondchars:
+        val |= 4
+    return val
+
+(pages, blocks) = build_pages(qc_entry, 0)
+print('/* Quick-check flags: the character is not allowed in NFD; not allowed')
+print('   in NFC; or might combine with the previous character in NFC. */')
+print('#define UNIGEN_QC_NFD_NO (1)')
+print('#define UNIGEN_QC_NFC_NO (2)')
+print('#define UNIGEN_QC_NFC_MAYBE (4)')
+print()
+print_array('unsigned char', 'unigen_qc_page', pages, '%d', 32)
+print('static unsigned char unigen_qc_blocks[%d][256] = {' % (len(blocks),))
+for block in blocks:
+    print('  {')
+    for pos in range(0, 256, 32):
+        print('    ' + ' '.join([ '%d,' % val for val in block[pos:pos+32] ]))
+    print('  },')
+print('};')
+print()
+
+# Compositions. The hash must match UNIGEN_COMPOSE_HASH below.
+
+bits = 1
+while (1 << bits) < 2 * len(compositions):
+    bits += 1
+size = 1 << bits
+
+def compose_hash(ch1, ch2):
+    val = ((ch1 * 0x9E3779B1) ^ (ch2 * 0x85EBCA77)) & 0xFFFFFFFF
+    return val >> (32 - bits)
+
+table = [ None ] * size
+for (ch1, ch2) in sorted(compositions):
+    pos = compose_hash(ch1, ch2)
+    while table[pos] is not None:
+        pos = (pos + 1) & (size - 1)
+    table[pos] = (ch1, ch2, compositions[(ch1, ch2)])
+
+print('/* No composition pair has a second character outside this range. */')
+print('#define UNIGEN_COMPOSE_MIN2 (0x%x)' % (min(ch2 for (ch1, ch2) in compositions),))
+print('#define UNIGEN_COMPOSE_MAX2 (0x%x)' % (max(ch2 for (ch1, ch2) in compositions),))
+print()
+print('#define UNIGEN_COMPOSE_BITS (%d)' % (bits,))
+print('#define UNIGEN_COMPOSE_HASH(ch1, ch2)  \\')
+print('    (((glui32)((ch1) * 0x9E3779B1U) ^ (glui32)((ch2) * 0x85EBCA77U)) >> (32 - UNIGEN_COMPOSE_BITS))')
+print()
+print('/* Open-addressed; an empty slot has a first character of zero. */')
+print('static glui32 unigen_compose_table[%d][3] = {' % (size,))
+for entry in table:
+    if entry is None:
+        print('    { 0, 0, 0 },')
+    else:
+        print('    { 0x%x, 0x%x, 0x%x },' % entry)
+print('};')
@@ -4,30 +4,37 @@
 #include "glk.h"
 #include "remglk.h"
 
-/* This file (and cgunigen.c) are copied directly from the cheapglk package. */
+/* This file was originally copied from the cheapglk package. cgunigen.c
+   is generated by casemap.py. */
 
-void gli_putchar_utf8(glui32 val, FILE *fl)
+/* Returns the number of bytes written. */
+int gli_putchar_utf8(glui32 val, FILE *fl)
 {
     if (val < 0x80) {
         putc(val, fl);
+        return 1;
     }
     else if (val < 0x800) {
         putc((0xC0 | ((val & 0x7C0) >> 6)), fl);
         putc((0x80 |  (val & 0x03F)     ),  fl);
+        return 2;
     }
     else if (val < 0x10000) {
         putc((0xE0 | ((val & 0xF000) >> 12)), fl);
         putc((0x80 | ((val & 0x0FC0) >>  6)), fl);
         putc((0x80 |  (val & 0x003F)      ),  fl);
+        return 3;
     }
     else if (val < 0x200000) {
         putc((0xF0 | ((val & 0x1C0000) >> 18)), fl);
         putc((0x80 | ((val & 0x03F000) >> 12)), fl);
         putc((0x80 | ((val & 0x000FC0) >>  6)), fl);
         putc((0x80 |  (val & 0x00003F)      ),  fl);
+        return 4;
     }
     else {
         putc('?', fl);
+        return 1;
     }
 }
 
@@ -177,6 +184,27 @@ glui32 gli_parse_utf8(unsigned char *buf, glui32 buflen,
 
 #include "cgunigen.c"
 
+/* Return the special-case offsets for ch, or NULL if it has none. There
+   are only a couple of hundred such characters, so this is a binary
+   search. */
+static glui32 *case_special(glui32 ch)
+{
+    int bot = 0;
+    int top = sizeof(unigen_special_chars) / sizeof(glui32);
+
+    while (bot < top) {
+        int val = (top+bot) / 2;
+        if (unigen_special_chars[val] == ch)
+            return unigen_special_offsets[val];
+        if (unigen_special_chars[val] < ch)
+            bot = val+1;
+        else
+            top = val;
+    }
+
+    return NULL;
+}
+
 #define CASE_UPPER (0)
 #define CASE_LOWER (1)
 #define CASE_TITLE (2)
@@ -228,7 +256,35 @@ static glui32 gli_buffer_change_case(glui32 *buf, glui32 len,
     outcount = 0;
     outbuf = buf;
 
-    for (ix=0; ix<numchars; ix++) {
+    /* Fast path: below 0x100, every character maps to exactly one
+       character, except sharp s. So we can convert a leading run of
+       ASCII and Latin-1 in place, straight from the page-zero block,
+       without the special-case table and without any chance of needing
+       a bigger buffer. We drop into the general loop at the first
+       character that isn't so simple. */
+    {
+        gli_case_block_t *latin1 = unigen_case_blocks[unigen_case_page[0]-1];
+        int target = dest_block_first;
+
+        for (ix=0; ix<numchars; ix++) {
+            glui32 ch = buf[ix];
+            if (ch >= 0x100 || ch == 0xDF)
+                break;
+            if (target == CASE_IDENT) {
+                if (ix != 0)
+                    return numchars; /* nothing more will change */
+            }
+            else {
+                buf[ix] = latin1[ch][target];
+            }
+            target = dest_block_rest;
+        }
+        if (ix >= numchars)
+            return numchars;
+        outcount = ix;
+    }
+
+    for (; ix<numchars; ix++) {
         int target;
         int isfirst;
         glui32 res;
@@ -245,13 +301,13 @@ static glui32 gli_buffer_change_case(glui32 *buf, glui32 len,
             res = ch;
         }
         else {
-            gli_case_block_t *block;
-
-            GET_CASE_BLOCK(ch, &block);
+            /* Page zero of unigen_case_page means nothing in the
+               page changes case. */
+            glui32 block = (ch < UNIGEN_LIMIT) ? unigen_case_page[ch >> 8] : 0;
             if (!block)
                 res = ch;
             else
-                res = block[ch & 0xFF][target];
+                res = unigen_case_blocks[block-1][ch & 0xFF][target];
         }
 
         if (res != 0xFFFFFFFF || res == ch) {
@@ -265,7 +321,7 @@ static glui32 gli_buffer_change_case(glui32 *buf, glui32 len,
         target = (isfirst ? dest_spec_first : dest_spec_rest);
 
         /* complicated cases */
-        GET_CASE_SPECIAL(ch, &special);
+        special = case_special(ch);
         if (!special) {
             gli_strict_warning("inconsistency in cgunigen.c");
             continue;
@@ -341,16 +397,19 @@ glui32 glk_buffer_to_title_case_uni(glui32 *buf, glui32 len,
 
 static glui32 combining_class(glui32 ch)
 {
-    RETURN_COMBINING_CLASS(ch);
+    if (ch >= UNIGEN_LIMIT)
+        return 0;
+    return unigen_combining_blocks[unigen_combining_page[ch >> 8]][ch & 0xFF];
 }
 
-/* This returns a new buffer (possibly longer), containing the decomposed
-   form of the original buffer. The caller must free the returned buffer.
-   On exit, *numcharsref contains the size of the returned buffer.
-   The original buffer is unchanged.
+/* This appends the decomposed form of the original buffer to *destref,
+   an array which holds *destlenref characters and has room for
+   *destsizeref. The array is reallocated as needed, and the three values
+   updated. The original buffer is unchanged. Returns FALSE if memory
+   runs out; *destref is then still valid, and the caller must free it.
 */
-static glui32 *gli_buffer_canon_decompose_uni(glui32 *buf, 
-    glui32 *numcharsref)
+static int gli_buffer_canon_decompose_uni(glui32 *buf, glui32 numchars,
+    glui32 **destref, glui32 *destlenref, glui32 *destsizeref)
 {
     /* The algorithm for the canonical decomposition of a string: For
        each character, look up the decomposition in the decomp table.
@@ -358,32 +417,25 @@ static glui32 *gli_buffer_canon_decompose_uni(glui32 *buf,
        substring of the buffer which is made up of combining
        characters (characters with a nonzero combining class). */
 
-    glui32 numchars = *numcharsref;
-    glui32 destsize = numchars * 2 + 16;
-    glui32 *dest = (glui32 *)malloc(destsize * sizeof(glui32));
-    glui32 destlen = 0;
+    glui32 *dest = *destref;
+    glui32 *newdest;
+    glui32 destsize = *destsizeref;
+    glui32 destlen = *destlenref;
+    glui32 startlen = destlen;
     glui32 ix, jx;
     int anycombining = FALSE;
 
-    if (!dest)
-        return NULL;
-
     for (ix=0; ix<numchars; ix++) {
         glui32 ch = buf[ix];
-        gli_decomp_block_t *block;
         glui32 count=0, pos=0;
 
         if (combining_class(ch))
             anycombining = TRUE;
 
-        GET_DECOMP_BLOCK(ch, &block);
-        if (block) {
-            block += (ch & 0xFF);
-            count = (*block)[0];
-            pos = (*block)[1];
-        }
-        else {
-            GET_DECOMP_SPECIAL(ch, &count, &pos);
+        if (ch < UNIGEN_LIMIT) {
+            pos = unigen_decomp_blocks[unigen_decomp_page[ch >> 8]][ch & 0xFF];
+            count = unigen_decomp_data[pos];
+            pos++;
         }
 
         if (!count) {
@@ -391,9 +443,12 @@ static glui32 *gli_buffer_canon_decompose_uni(glui32 *buf,
                it straight into the destination. */
             if (destlen >= destsize) {
                 destsize = destsize * 2;
-                dest = (glui32 *)realloc(dest, destsize * sizeof(glui32));
-                if (!dest)
-                    return NULL;
+                newdest = (glui32 *)realloc(dest, destsize * sizeof(glui32));
+                if (!newdest) {
+                    *destref = dest;
+                    return FALSE;
+                }
+                dest = newdest;
             }
             dest[destlen] = ch;
             destlen++;
@@ -413,9 +468,12 @@ static glui32 *gli_buffer_canon_decompose_uni(glui32 *buf,
         if (destlen+count >= destsize) {
             /* Okay, that wasn't enough. Expand more. */
             destsize = destsize * 2 + count;
-            dest = (glui32 *)realloc(dest, destsize * sizeof(glui32));
-            if (!dest)
-                return NULL;
+            newdest = (glui32 *)realloc(dest, destsize * sizeof(glui32));
+            if (!newdest) {
+                *destref = dest;
+                return FALSE;
+            }
+            dest = newdest;
         }
         for (jx=0; jx<count; jx++) {
             dest[destlen] = unigen_decomp_data[pos+jx];
@@ -428,7 +486,7 @@ static glui32 *gli_buffer_canon_decompose_uni(glui32 *buf,
            stable sort by the combining-class number. We're lazy and
            nearly all groups are short, so we'll just bubble-sort. */
         glui32 grpstart, grpend, kx;
-        ix = 0;
+        ix = startlen;
         while (ix < destlen) {
             if (!combining_class(dest[ix])) {
                 ix++;
@@ -455,13 +513,29 @@ static glui32 *gli_buffer_canon_decompose_uni(glui32 *buf,
         }
     }
 
-    *numcharsref = destlen;
-    return dest;
+    *destref = dest;
+    *destlenref = destlen;
+    *destsizeref = destsize;
+    return TRUE;
 }
 
 static glui32 check_composition(glui32 ch1, glui32 ch2)
 {
-    RETURN_COMPOSITION(ch1, ch2);
+    glui32 pos, mask;
+
+    if (ch2 < UNIGEN_COMPOSE_MIN2 || ch2 > UNIGEN_COMPOSE_MAX2)
+        return 0;
+
+    pos = UNIGEN_COMPOSE_HASH(ch1, ch2);
+    mask = (1 << UNIGEN_COMPOSE_BITS) - 1;
+    while (unigen_compose_table[pos][0]) {
+        if (unigen_compose_table[pos][0] == ch1 
+            && unigen_compose_table[pos][1] == ch2)
+            return unigen_compose_table[pos][2];
+        pos = (pos+1) & mask;
+    }
+
+    return 0;
 }
 
 /* This composes characters in the given buffer, in place. It returns the
@@ -521,46 +595,199 @@ static glui32 gli_buffer_canon_compose_uni(glui32 *buf, glui32 len)
     return pos;
 }
 
-glui32 glk_buffer_canon_decompose_uni(glui32 *buf, glui32 len,
-    glui32 numchars)
+/* Scan the buffer for the first character that might be changed by
+   normalization, using the quick-check flags in qcmask. If there is
+   none, return FALSE. Otherwise return TRUE, with *segstartref set to
+   the start of the segment that needs work (the last boundary at or
+   before the problem) and *problemref set to the problem itself.
+
+   A boundary is a starter (combining class zero) which passes the quick
+   check. Normalization never moves or merges characters across one, so
+   the text on either side can be normalized separately.
+*/
+static int gli_buffer_normal_quick_check(glui32 *buf, glui32 numchars,
+    int qcmask, glui32 *segstartref, glui32 *problemref)
 {
-    glui32 *dest = gli_buffer_canon_decompose_uni(buf, &numchars);
-    glui32 newlen;
+    glui32 ix;
+    glui32 segstart = 0;
+    glui32 lastclass = 0;
 
-    if (!dest)
-        return 0;
+    for (ix=0; ix<numchars; ix++) {
+        glui32 ch = buf[ix];
+        glui32 curclass, qc;
+
+        if (ch < 0x300) {
+            /* Nothing below U+0300 has a combining class or a
+               quick-check flag, except a few Latin-1 letters with
+               decompositions. Those fall through below. */
+            if (ch < 0xC0) {
+                segstart = ix;
+                lastclass = 0;
+                continue;
+            }
+        }
 
-    /* Copy the data back. */
-    newlen = numchars;
-    if (newlen > len)
-        newlen = len;
-    if (newlen)
-        memcpy(buf, dest, newlen * sizeof(glui32));
-    free(dest);
+        if (ch >= UNIGEN_LIMIT) {
+            curclass = 0;
+            qc = 0;
+        }
+        else {
+            curclass = unigen_combining_blocks[unigen_combining_page[ch >> 8]][ch & 0xFF];
+            qc = unigen_qc_blocks[unigen_qc_page[ch >> 8]][ch & 0xFF];
+        }
+
+        if ((qc & qcmask) || (curclass && lastclass > curclass)) {
+            *segstartref = segstart;
+            *problemref = ix;
+            return TRUE;
+        }
 
-    return numchars;
+        if (!curclass)
+            segstart = ix;
+        lastclass = curclass;
+    }
+
+    return FALSE;
 }
 
-glui32 glk_buffer_canon_normalize_uni(glui32 *buf, glui32 len,
-    glui32 numchars)
+/* Append count characters from src to *destref, in the same manner as
+   gli_buffer_canon_decompose_uni().
+*/
+static int gli_buffer_canon_append(glui32 **destref, glui32 *destlenref,
+    glui32 *destsizeref, glui32 *src, glui32 count)
 {
-    glui32 newlen;
-    glui32 *dest = gli_buffer_canon_decompose_uni(buf, &numchars);
+    glui32 *dest = *destref;
+
+    if (*destlenref + count > *destsizeref) {
+        glui32 newsize = (*destlenref + count) * 2 + 16;
+        dest = (glui32 *)realloc(dest, newsize * sizeof(glui32));
+        if (!dest)
+            return FALSE;
+        *destref = dest;
+        *destsizeref = newsize;
+    }
+
+    memcpy(dest + *destlenref, src, count * sizeof(glui32));
+    *destlenref += count;
+    return TRUE;
+}
 
-    if (!dest)
+/* Decompose (and, if compose is set, recompose) the buffer. Segments
+   that already pass the quick check are copied through untouched; if
+   the whole buffer passes, it is left alone and nothing is allocated.
+   Returns the full length of the result, which may be more than len;
+   only len characters are written back.
+*/
+static glui32 gli_buffer_canon_normalize_spans(glui32 *buf, glui32 len,
+    glui32 numchars, int compose)
+{
+    int qcmask = (compose ? (UNIGEN_QC_NFC_NO|UNIGEN_QC_NFC_MAYBE) : UNIGEN_QC_NFD_NO);
+    glui32 *out;
+    glui32 outlen, outsize;
+    glui32 pos, segstart, problem, newlen;
+
+    if (!gli_buffer_normal_quick_check(buf, numchars, qcmask, 
+        &segstart, &problem))
+        return numchars;
+
+    outsize = numchars * 2 + 16;
+    out = (glui32 *)malloc(outsize * sizeof(glui32));
+    if (!out)
         return 0;
+    outlen = 0;
 
-    numchars = gli_buffer_canon_compose_uni(dest, numchars);
+    pos = 0;
+    while (1) {
+        glui32 segend, segout, nextstart, nextproblem;
+        int more;
+
+        /* Copy through the clean text before the segment. (The offsets
+           from the quick check are relative to pos.) */
+        segstart += pos;
+        problem += pos;
+        if (segstart > pos) {
+            if (!gli_buffer_canon_append(&out, &outlen, &outsize,
+                buf+pos, segstart-pos)) {
+                free(out);
+                return 0;
+            }
+        }
+
+        /* The segment runs to the next boundary after the problem. If
+           another problem turns up soon after that, take it into the same
+           segment; renormalizing a few clean characters is cheaper than
+           starting over. Once a segment gets long, the text is evidently
+           full of problems, so we stop scanning and take the rest. */
+        while (1) {
+            if (problem - segstart >= 256) {
+                segend = numchars;
+                more = FALSE;
+                break;
+            }
+            for (segend=problem+1; segend<numchars; segend++) {
+                glui32 ch = buf[segend];
+                if (ch >= UNIGEN_LIMIT)
+                    break;
+                if (!unigen_combining_blocks[unigen_combining_page[ch >> 8]][ch & 0xFF]
+                    && !(unigen_qc_blocks[unigen_qc_page[ch >> 8]][ch & 0xFF] & qcmask))
+                    break;
+            }
+            more = (segend < numchars
+                && gli_buffer_normal_quick_check(buf+segend, numchars-segend,
+                    qcmask, &nextstart, &nextproblem));
+            if (!more || nextstart >= 32)
+                break;
+            problem = segend + nextproblem;
+        }
+
+        /* Decompose the segment onto the end of the output, and compose
+           it there if needed. */
+        segout = outlen;
+        if (!gli_buffer_canon_decompose_uni(buf+segstart, segend-segstart,
+            &out, &outlen, &outsize)) {
+            free(out);
+            return 0;
+        }
+        if (compose)
+            outlen = segout + gli_buffer_canon_compose_uni(out+segout,
+                outlen-segout);
+
+        pos = segend;
+        if (!more) {
+            if (pos < numchars) {
+                if (!gli_buffer_canon_append(&out, &outlen, &outsize,
+                    buf+pos, numchars-pos)) {
+                    free(out);
+                    return 0;
+                }
+            }
+            break;
+        }
+        segstart = nextstart;
+        problem = nextproblem;
+    }
 
     /* Copy the data back. */
-    newlen = numchars;
+    newlen = outlen;
     if (newlen > len)
         newlen = len;
     if (newlen)
-        memcpy(buf, dest, newlen * sizeof(glui32));
-    free(dest);
+        memcpy(buf, out, newlen * sizeof(glui32));
+    free(out);
 
-    return numchars;
+    return outlen;
+}
+
+glui32 glk_buffer_canon_decompose_uni(glui32 *buf, glui32 len,
+    glui32 numchars)
+{
+    return gli_buffer_canon_normalize_spans(buf, len, numchars, FALSE);
+}
+
+glui32 glk_buffer_canon_normalize_uni(glui32 *buf, glui32 len,
+    glui32 numchars)
+{
+    return gli_buffer_canon_normalize_spans(buf, len, numchars, TRUE);
 }
 
 #endif /* GLK_MODULE_UNICODE_NORM */
@@ -55,6 +55,13 @@ typedef struct giblorb_resdesc_struct {
     glui32 chunknum;
 } giblorb_resdesc_t;
 
+/* giblorb_typedir_t: Lists the chunks of one type, in file order. */
+typedef struct giblorb_typedir_struct {
+    glui32 type;
+    int count;
+    int *chunknums; /* points into map->typechunks */
+} giblorb_typedir_t;
+
 /* giblorb_auxpict_t: Extra information about an image. */
 typedef struct giblorb_auxpict_struct {
     int loaded;
@@ -74,25 +81,44 @@ struct giblorb_map_struct {
     
     int numresources;
     giblorb_resdesc_t *resources; /* list of resource descriptors */
-    giblorb_resdesc_t **ressorted; /* list of pointers to descriptors 
-        in map->resources -- sorted by usage and resource number. */
+    int *reshash; /* open-addressed hash table of indexes into 
+        map->resources, keyed by usage and resource number. Empty slots 
+        are -1. */
+    glui32 reshashsize; /* a power of two, at least twice numresources */
+
+    int numtypes;
+    giblorb_typedir_t *typedir; /* one entry per distinct chunk type */
+    int *typechunks; /* chunk numbers, grouped by type (numchunks long) */
 
     giblorb_auxpict_t *auxpict;
+
+    unsigned char *fileptr; /* the whole file, if the platform has
+        supplied it with giblorb_set_file_memory(); otherwise NULL */
+    glui32 filelen;
 };
 
 #define giblorb_Inited_Magic (0xB7012BED) 
 
+/* How much of the file giblorb_create_map() reads at a time while
+    indexing chunk headers. */
+#define giblorb_Window_Size (4096)
+
 /* Static variables. */
 
 static int lib_inited = FALSE;
 
 static giblorb_err_t giblorb_initialize(void);
+static giblorb_map_t *giblorb_new_map(strid_t file, 
+    giblorb_chunkdesc_t *chunks, int numchunks);
 static giblorb_err_t giblorb_initialize_map(giblorb_map_t *map);
-static giblorb_err_t giblorb_image_get_size_jpeg(unsigned char *ptr, glui32 length, giblorb_auxpict_t *auxpict);
-static giblorb_err_t giblorb_image_get_size_png(unsigned char *ptr, glui32 length, giblorb_auxpict_t *auxpict);
-static void giblorb_qsort(giblorb_resdesc_t **list, int len);
-static giblorb_resdesc_t *giblorb_bsearch(giblorb_resdesc_t *sample, 
-    giblorb_resdesc_t **list, int len);
+static glui32 giblorb_read_chunk_bytes(giblorb_map_t *map, 
+    giblorb_chunkdesc_t *chu, glui32 offset, unsigned char *buf, glui32 len);
+static giblorb_err_t giblorb_image_get_size_jpeg(giblorb_map_t *map, giblorb_chunkdesc_t *chu, giblorb_auxpict_t *auxpict);
+static giblorb_err_t giblorb_image_get_size_png(giblorb_map_t *map, giblorb_chunkdesc_t *chu, giblorb_auxpict_t *auxpict);
+static giblorb_err_t giblorb_build_typedir(giblorb_map_t *map);
+static giblorb_err_t giblorb_build_reshash(giblorb_map_t *map);
+static giblorb_resdesc_t *giblorb_find_resource(giblorb_map_t *map,
+    glui32 usage, glui32 resnum);
 static void *giblorb_malloc(glui32 len);
 static void *giblorb_realloc(void *ptr, glui32 len);
 static void giblorb_free(void *ptr);
@@ -111,6 +137,8 @@ giblorb_err_t giblorb_create_map(strid_t file, giblorb_map_t **newmap)
     giblorb_chunkdesc_t *chunks;
     int chunks_size, numchunks;
     char buffer[16];
+    char *window;
+    glui32 windowpos, windowlen;
     
     *newmap = NULL;
     
@@ -142,21 +170,40 @@ giblorb_err_t giblorb_create_map(strid_t file, giblorb_map_t **newmap)
     chunks = (giblorb_chunkdesc_t *)giblorb_malloc(sizeof(giblorb_chunkdesc_t) 
         * chunks_size);
 
+    /* Chunk headers are read through a window, so that a run of small
+        chunks costs one read rather than a seek and read apiece. We
+        only move the window (seeking forward) when the next header
+        falls outside it. */
+    window = (char *)giblorb_malloc(giblorb_Window_Size);
+    if (!chunks || !window) {
+        giblorb_free(chunks);
+        giblorb_free(window);
+        return giblorb_err_Alloc;
+    }
+    windowpos = 0;
+    windowlen = 0;
+
     while (nextpos < totallength) {
         glui32 type, len;
         int chunum;
         giblorb_chunkdesc_t *chu;
+        char *header;
         
-        glk_stream_set_position(file, nextpos, seekmode_Start);
-        
-        readlen = glk_get_buffer_stream(file, buffer, 8);
-        if (readlen != 8) {
-            giblorb_free(chunks);
-            return giblorb_err_Read;
+        if (nextpos < windowpos || nextpos+8 > windowpos+windowlen) {
+            glk_stream_set_position(file, nextpos, seekmode_Start);
+            windowpos = nextpos;
+            windowlen = glk_get_buffer_stream(file, window, 
+                giblorb_Window_Size);
+            if (windowlen < 8) {
+                giblorb_free(window);
+                giblorb_free(chunks);
+                return giblorb_err_Read;
+            }
         }
+        header = window + (nextpos - windowpos);
         
-        type = giblorb_native4(buffer+0);
-        len = giblorb_native4(buffer+4);
+        type = giblorb_native4(header+0);
+        len = giblorb_native4(header+4);
         
         if (numchunks >= chunks_size) {
             chunks_size *= 2;
@@ -186,27 +233,58 @@ giblorb_err_t giblorb_create_map(strid_t file, giblorb_map_t **newmap)
             nextpos++;
             
         if (nextpos > totallength) {
+            giblorb_free(window);
             giblorb_free(chunks);
             return giblorb_err_Format;
         }
     }
+
+    giblorb_free(window);
     
     /* The basic IFF structure seems to be ok, and we have a list of
         chunks. Now we allocate the map structure itself. */
     
-    map = (giblorb_map_t *)giblorb_malloc(sizeof(giblorb_map_t));
+    map = giblorb_new_map(file, chunks, numchunks);
     if (!map) {
         giblorb_free(chunks);
         return giblorb_err_Alloc;
     }
+    
+    /* Now we do everything else involved in loading the Blorb file,
+        such as building resource lists. */
+    
+    err = giblorb_initialize_map(map);
+    if (err) {
+        giblorb_destroy_map(map);
+        return err;
+    }
+    
+    *newmap = map;
+    return giblorb_err_None;
+}
+
+/* Allocate a map structure around a chunk list. The map takes 
+    ownership of the list. */
+static giblorb_map_t *giblorb_new_map(strid_t file, 
+    giblorb_chunkdesc_t *chunks, int numchunks)
+{
+    giblorb_map_t *map;
+
+    map = (giblorb_map_t *)giblorb_malloc(sizeof(giblorb_map_t));
+    if (!map)
+        return NULL;
         
     map->inited = giblorb_Inited_Magic;
     map->file = file;
     map->chunks = chunks;
     map->numchunks = numchunks;
     map->resources = NULL;
-    map->ressorted = NULL;
+    map->reshash = NULL;
+    map->reshashsize = 0;
     map->numresources = 0;
+    map->numtypes = 0;
+    map->typedir = NULL;
+    map->typechunks = NULL;
     /*map->releasenum = 0;
     map->zheader = NULL;
     map->resolution = NULL;
@@ -214,18 +292,10 @@ giblorb_err_t giblorb_create_map(strid_t file, giblorb_map_t **newmap)
     map->palette = NULL;
     map->auxsound = NULL;*/
     map->auxpict = NULL;
-    
-    /* Now we do everything else involved in loading the Blorb file,
-        such as building resource lists. */
-    
-    err = giblorb_initialize_map(map);
-    if (err) {
-        giblorb_destroy_map(map);
-        return err;
-    }
-    
-    *newmap = map;
-    return giblorb_err_None;
+    map->fileptr = NULL;
+    map->filelen = 0;
+
+    return map;
 }
 
 static giblorb_err_t giblorb_initialize_map(giblorb_map_t *map)
@@ -250,7 +320,7 @@ static giblorb_err_t giblorb_initialize_map(giblorb_map_t *map)
         
             case giblorb_ID_RIdx:
                 /* Resource index chunk: build the resource list and 
-                sort it. */
+                hash it. */
                 
                 if (gotindex) 
                     return giblorb_err_Format; /* duplicate index chunk */
@@ -269,7 +339,6 @@ static giblorb_err_t giblorb_initialize_map(giblorb_map_t *map)
                 if (numres) {
                     int ix2;
                     giblorb_resdesc_t *resources = NULL;
-                    giblorb_resdesc_t **ressorted = NULL;
                     
                     if (len != numres*12+4)
                         return giblorb_err_Format; /* bad length field */
@@ -279,12 +348,6 @@ static giblorb_err_t giblorb_initialize_map(giblorb_map_t *map)
                     if (!resources) {
                         return giblorb_err_Alloc;
                     }
-                    ressorted = (giblorb_resdesc_t **)giblorb_malloc(numres 
-                        * sizeof(giblorb_resdesc_t *));
-                    if (!ressorted) {
-                        giblorb_free(resources);
-                        return giblorb_err_Alloc;
-                    }
                     
                     ix2 = 0;
                     for (jx=0; jx<numres; jx++) {
@@ -303,23 +366,20 @@ static giblorb_err_t giblorb_initialize_map(giblorb_map_t *map)
                             || map->chunks[ix2].startpos != respos) {
                             /* start pos does not match a real chunk */
                             giblorb_free(resources);
-                            giblorb_free(ressorted);
                             return giblorb_err_Format;
                         }
                         
                         res->chunknum = ix2;
-                        
-                        ressorted[jx] = res;
                     }
                     
-                    /* Sort a resource list (actually a list of pointers to 
-                        structures in map->resources.) This makes it easy 
-                        to find resources by usage and resource number. */
-                    giblorb_qsort(ressorted, numres);
-                    
                     map->numresources = numres;
                     map->resources = resources;
-                    map->ressorted = ressorted;
+
+                    /* Hash the resource list by usage and resource 
+                        number, so that lookups don't have to search. */
+                    err = giblorb_build_reshash(map);
+                    if (err)
+                        return err;
                 }
                 
                 giblorb_unload_chunk(map, ix);
@@ -348,6 +408,10 @@ static giblorb_err_t giblorb_initialize_map(giblorb_map_t *map)
             auxpict->alttext = NULL;
         }
     }
+
+    err = giblorb_build_typedir(map);
+    if (err)
+        return err;
     
     return giblorb_err_None;
 }
@@ -384,14 +448,29 @@ giblorb_err_t giblorb_destroy_map(giblorb_map_t *map)
         map->resources = NULL;
     }
     
-    if (map->ressorted) {
-        giblorb_free(map->ressorted);
-        map->ressorted = NULL;
+    if (map->reshash) {
+        giblorb_free(map->reshash);
+        map->reshash = NULL;
     }
+    map->reshashsize = 0;
     
     map->numresources = 0;
+
+    if (map->typedir) {
+        giblorb_free(map->typedir);
+        map->typedir = NULL;
+    }
+    
+    if (map->typechunks) {
+        giblorb_free(map->typechunks);
+        map->typechunks = NULL;
+    }
+    
+    map->numtypes = 0;
     
     map->file = NULL;
+    map->fileptr = NULL;
+    map->filelen = 0;
     map->inited = 0;
     
     giblorb_free(map);
@@ -407,19 +486,17 @@ giblorb_err_t giblorb_load_chunk_by_type(giblorb_map_t *map,
 {
     int ix;
     
-    for (ix=0; ix < map->numchunks; ix++) {
-        if (map->chunks[ix].type == type) {
-            if (count == 0)
-                break;
-            count--;
+    for (ix=0; ix < map->numtypes; ix++) {
+        giblorb_typedir_t *dir = &(map->typedir[ix]);
+        if (dir->type == type) {
+            if (count >= dir->count)
+                return giblorb_err_NotFound;
+            return giblorb_load_chunk_by_number(map, method, res, 
+                dir->chunknums[count]);
         }
     }
     
-    if (ix >= map->numchunks) {
-        return giblorb_err_NotFound;
-    }
-    
-    return giblorb_load_chunk_by_number(map, method, res, ix);
+    return giblorb_err_NotFound;
 }
 
 giblorb_err_t giblorb_load_chunk_by_number(giblorb_map_t *map, 
@@ -443,6 +520,15 @@ giblorb_err_t giblorb_load_chunk_by_number(giblorb_map_t *map,
             break;
             
         case giblorb_method_Memory:
+            if (!chu->ptr && map->fileptr 
+                && chu->datpos <= map->filelen
+                && chu->len <= map->filelen - chu->datpos) {
+                /* Point straight into the file block. Nothing is 
+                    allocated, so chu->ptr stays NULL and unloading 
+                    is a no-op. */
+                res->data.ptr = map->fileptr + chu->datpos;
+                break;
+            }
             if (!chu->ptr) {
                 glui32 readlen;
                 void *dat = giblorb_malloc(chu->len);
@@ -474,13 +560,9 @@ giblorb_err_t giblorb_load_chunk_by_number(giblorb_map_t *map,
 giblorb_err_t giblorb_load_resource(giblorb_map_t *map, glui32 method, 
     giblorb_result_t *res, glui32 usage, glui32 resnum)
 {
-    giblorb_resdesc_t sample;
     giblorb_resdesc_t *found;
     
-    sample.usage = usage;
-    sample.resnum = resnum;
-    
-    found = giblorb_bsearch(&sample, map->ressorted, map->numresources);
+    found = giblorb_find_resource(map, usage, resnum);
     
     if (!found)
         return giblorb_err_NotFound;
@@ -505,6 +587,220 @@ giblorb_err_t giblorb_unload_chunk(giblorb_map_t *map, glui32 chunknum)
     return giblorb_err_None;
 }
 
+giblorb_err_t giblorb_set_file_memory(giblorb_map_t *map,
+    void *ptr, glui32 len)
+{
+    if (!map || map->inited != giblorb_Inited_Magic)
+        return giblorb_err_NotAMap;
+
+    map->fileptr = (unsigned char *)ptr;
+    map->filelen = (ptr ? len : 0);
+
+    return giblorb_err_None;
+}
+
+/* The index block written by giblorb_export_index() is an array of
+    native-order glui32 values:
+        magic, version, numchunks, numresources, numpicts
+        numchunks * (type, len, startpos, datpos)
+        numresources * (usage, resnum, chunknum)
+        numpicts * (loaded, width, height)
+    It is meant to be cached on the same machine, not carried between
+    platforms. */
+#define giblorb_Index_Magic (giblorb_make_id('G', 'B', 'I', 'x'))
+#define giblorb_Index_Version (1)
+
+giblorb_err_t giblorb_export_index(giblorb_map_t *map, 
+    void **buf, glui32 *len)
+{
+    glui32 *arr, *ptr;
+    glui32 count;
+    int ix, numpicts;
+
+    *buf = NULL;
+    *len = 0;
+
+    if (!map || map->inited != giblorb_Inited_Magic)
+        return giblorb_err_NotAMap;
+
+    /* Fill in the image sizes now, so that whoever reads the index
+        gets them for free. An image we can't measure is left 
+        unloaded; it will fail the same way when it's asked for. */
+    numpicts = 0;
+    for (ix=0; ix<map->numchunks; ix++) {
+        giblorb_chunkdesc_t *chu = &(map->chunks[ix]);
+        giblorb_auxpict_t *auxpict;
+        giblorb_err_t err;
+        if (chu->auxdatnum < 0)
+            continue;
+        numpicts++;
+        auxpict = &(map->auxpict[chu->auxdatnum]);
+        if (auxpict->loaded)
+            continue;
+        if (chu->type == giblorb_ID_JPEG)
+            err = giblorb_image_get_size_jpeg(map, chu, auxpict);
+        else 
+            err = giblorb_image_get_size_png(map, chu, auxpict);
+        if (!err)
+            auxpict->loaded = TRUE;
+    }
+
+    count = 5 + 4*map->numchunks + 3*map->numresources + 3*numpicts;
+    arr = (glui32 *)giblorb_malloc(count * sizeof(glui32));
+    if (!arr)
+        return giblorb_err_Alloc;
+
+    ptr = arr;
+    *ptr++ = giblorb_Index_Magic;
+    *ptr++ = giblorb_Index_Version;
+    *ptr++ = map->numchunks;
+    *ptr++ = map->numresources;
+    *ptr++ = numpicts;
+    for (ix=0; ix<map->numchunks; ix++) {
+        giblorb_chunkdesc_t *chu = &(map->chunks[ix]);
+        *ptr++ = chu->type;
+        *ptr++ = chu->len;
+        *ptr++ = chu->startpos;
+        *ptr++ = chu->datpos;
+    }
+    for (ix=0; ix<map->numresources; ix++) {
+        giblorb_resdesc_t *res = &(map->resources[ix]);
+        *ptr++ = res->usage;
+        *ptr++ = res->resnum;
+        *ptr++ = res->chunknum;
+    }
+    for (ix=0; ix<numpicts; ix++) {
+        giblorb_auxpict_t *auxpict = &(map->auxpict[ix]);
+        *ptr++ = auxpict->loaded;
+        *ptr++ = auxpict->width;
+        *ptr++ = auxpict->height;
+    }
+
+    *buf = arr;
+    *len = count * sizeof(glui32);
+    return giblorb_err_None;
+}
+
+giblorb_err_t giblorb_create_map_from_index(strid_t file, 
+    void *buf, glui32 len, glui32 filelen, giblorb_map_t **newmap)
+{
+    giblorb_err_t err;
+    giblorb_map_t *map;
+    giblorb_chunkdesc_t *chunks;
+    glui32 *ptr = (glui32 *)buf;
+    glui32 numchunks, numres, numpicts, count;
+    int ix, pictcount;
+
+    *newmap = NULL;
+
+    if (!lib_inited) {
+        err = giblorb_initialize();
+        if (err)
+            return err;
+        lib_inited = TRUE;
+    }
+
+    /* Check the shape of the block before trusting any of it. */
+    if (!buf || len < 5*sizeof(glui32) || (len % sizeof(glui32)))
+        return giblorb_err_Format;
+    if (ptr[0] != giblorb_Index_Magic || ptr[1] != giblorb_Index_Version)
+        return giblorb_err_Format;
+    numchunks = ptr[2];
+    numres = ptr[3];
+    numpicts = ptr[4];
+    if (numchunks == 0 || (numchunks | numres | numpicts) & 0xF0000000)
+        return giblorb_err_Format;
+    count = 5 + 4*numchunks + 3*numres + 3*numpicts;
+    if (len != count * sizeof(glui32))
+        return giblorb_err_Format;
+    ptr += 5;
+
+    chunks = (giblorb_chunkdesc_t *)giblorb_malloc(sizeof(giblorb_chunkdesc_t) 
+        * numchunks);
+    if (!chunks)
+        return giblorb_err_Alloc;
+
+    pictcount = 0;
+    for (ix=0; ix<numchunks; ix++) {
+        giblorb_chunkdesc_t *chu = &(chunks[ix]);
+        chu->type = *ptr++;
+        chu->len = *ptr++;
+        chu->startpos = *ptr++;
+        chu->datpos = *ptr++;
+        chu->ptr = NULL;
+        chu->auxdatnum = -1;
+        if (chu->startpos > chu->datpos || chu->datpos > filelen
+            || chu->len > filelen - chu->datpos) {
+            giblorb_free(chunks);
+            return giblorb_err_Format;
+        }
+        if (chu->type == giblorb_ID_JPEG || chu->type == giblorb_ID_PNG) {
+            chu->auxdatnum = pictcount;
+            pictcount++;
+        }
+    }
+    if (pictcount != numpicts) {
+        giblorb_free(chunks);
+        return giblorb_err_Format;
+    }
+
+    map = giblorb_new_map(file, chunks, numchunks);
+    if (!map) {
+        giblorb_free(chunks);
+        return giblorb_err_Alloc;
+    }
+
+    if (numres) {
+        map->resources = (giblorb_resdesc_t *)giblorb_malloc(numres 
+            * sizeof(giblorb_resdesc_t));
+        if (!map->resources) {
+            giblorb_destroy_map(map);
+            return giblorb_err_Alloc;
+        }
+        map->numresources = numres;
+        for (ix=0; ix<numres; ix++) {
+            giblorb_resdesc_t *res = &(map->resources[ix]);
+            res->usage = *ptr++;
+            res->resnum = *ptr++;
+            res->chunknum = *ptr++;
+            if (res->chunknum >= numchunks) {
+                giblorb_destroy_map(map);
+                return giblorb_err_Format;
+            }
+        }
+        err = giblorb_build_reshash(map);
+        if (err) {
+            giblorb_destroy_map(map);
+            return err;
+        }
+    }
+
+    if (numpicts) {
+        map->auxpict = (giblorb_auxpict_t *)giblorb_malloc(numpicts 
+            * sizeof(giblorb_auxpict_t));
+        if (!map->auxpict) {
+            giblorb_destroy_map(map);
+            return giblorb_err_Alloc;
+        }
+        for (ix=0; ix<numpicts; ix++) {
+            giblorb_auxpict_t *auxpict = &(map->auxpict[ix]);
+            auxpict->loaded = (*ptr++ != 0);
+            auxpict->width = *ptr++;
+            auxpict->height = *ptr++;
+            auxpict->alttext = NULL;
+        }
+    }
+
+    err = giblorb_build_typedir(map);
+    if (err) {
+        giblorb_destroy_map(map);
+        return err;
+    }
+
+    *newmap = map;
+    return giblorb_err_None;
+}
+
 giblorb_err_t giblorb_count_resources(giblorb_map_t *map, glui32 usage,
     glui32 *num, glui32 *min, glui32 *max)
 {
@@ -548,16 +844,12 @@ giblorb_err_t giblorb_count_resources(giblorb_map_t *map, glui32 usage,
 giblorb_err_t giblorb_load_image_info(giblorb_map_t *map,
     glui32 resnum, giblorb_image_info_t *res)
 {
-    giblorb_resdesc_t sample;
     giblorb_resdesc_t *found;
     glui32 chunknum;
     giblorb_chunkdesc_t *chu;
     giblorb_auxpict_t *auxpict;
     
-    sample.usage = giblorb_ID_Pict;
-    sample.resnum = resnum;
-    
-    found = giblorb_bsearch(&sample, map->ressorted, map->numresources);
+    found = giblorb_find_resource(map, giblorb_ID_Pict, resnum);
     
     if (!found)
         return giblorb_err_NotFound;
@@ -572,20 +864,18 @@ giblorb_err_t giblorb_load_image_info(giblorb_map_t *map,
 
     auxpict = &(map->auxpict[chu->auxdatnum]);
     if (!auxpict->loaded) {
-        giblorb_result_t res;
-        giblorb_err_t err = giblorb_load_chunk_by_number(map, giblorb_method_Memory, &res, chunknum);
-        if (err)
-            return err;
+        /* We only need the image dimensions, which are near the start
+            of the data. So rather than loading the whole chunk, we 
+            read the header blocks a few bytes at a time. */
+        giblorb_err_t err;
 
         if (chu->type == giblorb_ID_JPEG)
-            err = giblorb_image_get_size_jpeg(res.data.ptr, res.length, auxpict);
+            err = giblorb_image_get_size_jpeg(map, chu, auxpict);
         else if (chu->type == giblorb_ID_PNG)
-            err = giblorb_image_get_size_png(res.data.ptr, res.length, auxpict);
+            err = giblorb_image_get_size_png(map, chu, auxpict);
         else
             err = giblorb_err_Format;
 
-        giblorb_unload_chunk(map, chunknum);
-
         if (err)
             return err;
 
@@ -599,34 +889,80 @@ giblorb_err_t giblorb_load_image_info(giblorb_map_t *map,
     return giblorb_err_None;
 }
 
-static giblorb_err_t giblorb_image_get_size_jpeg(unsigned char *arr, glui32 length, giblorb_auxpict_t *auxpict)
+/* Copy up to len bytes of a chunk's data, starting at offset, into buf.
+    This reads from memory if the chunk (or the whole file) is there,
+    and from the file otherwise. Returns the number of bytes copied, 
+    which will be short at the end of the chunk. */
+static glui32 giblorb_read_chunk_bytes(giblorb_map_t *map, 
+    giblorb_chunkdesc_t *chu, glui32 offset, unsigned char *buf, glui32 len)
+{
+    unsigned char *src = NULL;
+    glui32 ix;
+
+    if (offset >= chu->len)
+        return 0;
+    if (len > chu->len - offset)
+        len = chu->len - offset;
+
+    if (chu->ptr)
+        src = (unsigned char *)chu->ptr + offset;
+    else if (map->fileptr && chu->datpos + chu->len <= map->filelen)
+        src = map->fileptr + chu->datpos + offset;
+
+    if (src) {
+        for (ix=0; ix<len; ix++)
+            buf[ix] = src[ix];
+        return len;
+    }
+
+    glk_stream_set_position(map->file, chu->datpos + offset, seekmode_Start);
+    return glk_get_buffer_stream(map->file, (char *)buf, len);
+}
+
+static giblorb_err_t giblorb_image_get_size_jpeg(giblorb_map_t *map, giblorb_chunkdesc_t *chu, giblorb_auxpict_t *auxpict)
 {
-    int pos = 0;
-    while (pos < length) {
+    unsigned char buf[16];
+    glui32 pos = 0;
+    while (pos < chu->len) {
         unsigned char marker;
-        int chunklen;
-        if (arr[pos] != 0xFF) {
+        glui32 chunklen, got;
+        int ix;
+        got = giblorb_read_chunk_bytes(map, chu, pos, buf, 16);
+        if (got < 2 || buf[0] != 0xFF) {
             /* error: find_dimensions_jpeg: marker is not 0xFF */
             return giblorb_err_Format;
         }
-        while (arr[pos] == 0xFF) 
-            pos += 1;
-        marker = arr[pos];
-        pos += 1;
+        ix = 0;
+        while (ix < got && buf[ix] == 0xFF) 
+            ix += 1;
+        if (ix >= got) {
+            /* A long run of fill bytes. Step over all but the last. */
+            pos += got-1;
+            continue;
+        }
+        marker = buf[ix];
+        pos += ix+1;
         if (marker == 0x01 || (marker >= 0xD0 && marker <= 0xD9)) {
             /* marker type has no data */
             continue;
         }
-        chunklen = (arr[pos+0] << 8) | (arr[pos+1]);
+        got = giblorb_read_chunk_bytes(map, chu, pos, buf, 7);
+        if (got < 2)
+            return giblorb_err_Format;
+        chunklen = (buf[0] << 8) | (buf[1]);
         if (marker >= 0xC0 && marker <= 0xCF && marker != 0xC8) {
-            if (chunklen < 7) {
+            if (chunklen < 7 || got < 7) {
                 /* error: find_dimensions_jpeg: SOF block is too small */
                 return giblorb_err_Format;
             }
-            auxpict->height = (arr[pos+3] << 8) | (arr[pos+4]);
-            auxpict->width  = (arr[pos+5] << 8) | (arr[pos+6]);
+            auxpict->height = (buf[3] << 8) | (buf[4]);
+            auxpict->width  = (buf[5] << 8) | (buf[6]);
             return giblorb_err_None;
         }
+        if (chunklen < 2) {
+            /* error: find_dimensions_jpeg: block length is too small */
+            return giblorb_err_Format;
+        }
         pos += chunklen;
     }
 
@@ -634,29 +970,36 @@ static giblorb_err_t giblorb_image_get_size_jpeg(unsigned char *arr, glui32 leng
     return giblorb_err_Format;
 }
 
-static giblorb_err_t giblorb_image_get_size_png(unsigned char *arr, glui32 length, giblorb_auxpict_t *auxpict)
+static giblorb_err_t giblorb_image_get_size_png(giblorb_map_t *map, giblorb_chunkdesc_t *chu, giblorb_auxpict_t *auxpict)
 {
-    int pos = 0;
-    if (length < 8)
+    unsigned char buf[16];
+    glui32 pos = 0;
+    if (giblorb_read_chunk_bytes(map, chu, 0, buf, 8) < 8)
         return giblorb_err_Format;
-    if (arr[0] != 0x89 || arr[1] != 'P' || arr[2] != 'N' || arr[3] != 'G') {
+    if (buf[0] != 0x89 || buf[1] != 'P' || buf[2] != 'N' || buf[3] != 'G') {
         /* error: find_dimensions_png: PNG signature does not match */
         return giblorb_err_Format;
     }
     pos += 8;
-    while (pos < length) {
-        glui32 chunklen = giblorb_native4(arr+pos);
-        glui32 chunktype;
-        pos += 4;
-        chunktype = giblorb_native4(arr+pos);
-        pos += 4;
+    while (pos < chu->len) {
+        glui32 chunklen, chunktype;
+        /* IHDR is required to come first, so this normally reads the
+            block header and the dimensions in one go. */
+        glui32 got = giblorb_read_chunk_bytes(map, chu, pos, buf, 16);
+        if (got < 8)
+            return giblorb_err_Format;
+        chunklen = giblorb_native4(buf);
+        chunktype = giblorb_native4(buf+4);
         if (chunktype == giblorb_make_id('I', 'H', 'D', 'R')) {
-            auxpict->width = giblorb_native4(arr+pos);
-            pos += 4;
-            auxpict->height = giblorb_native4(arr+pos);
-            pos += 4;
+            if (got < 16)
+                return giblorb_err_Format;
+            auxpict->width = giblorb_native4(buf+8);
+            auxpict->height = giblorb_native4(buf+12);
             return giblorb_err_None;
         }
+        if (chunklen > chu->len)
+            return giblorb_err_Format;
+        pos += 8;
         pos += chunklen;
         pos += 4; /* skip CRC */
     }
@@ -665,84 +1008,112 @@ static giblorb_err_t giblorb_image_get_size_png(unsigned char *arr, glui32 lengt
     return giblorb_err_Format;
 }
 
-/* Sorting and searching. */
+/* Hashing and searching. */
 
-static int sortsplot(giblorb_resdesc_t *v1, giblorb_resdesc_t *v2)
-{
-    if (v1->usage < v2->usage)
-        return -1;
-    if (v1->usage > v2->usage)
-        return 1;
-    if (v1->resnum < v2->resnum)
-        return -1;
-    if (v1->resnum > v2->resnum)
-        return 1;
-    return 0;
-}
+#define giblorb_hash(usage, resnum)   \
+    (((usage) * 0x9E3779B1) ^ ((resnum) * 0x85EBCA77))
 
-static void giblorb_qsort(giblorb_resdesc_t **list, int len)
+static giblorb_err_t giblorb_build_reshash(giblorb_map_t *map)
 {
-    int ix, jx, res;
-    giblorb_resdesc_t *tmpptr, *pivot;
-    
-    if (len < 6) {
-        /* The list is short enough for a bubble-sort. */
-        for (jx=len-1; jx>0; jx--) {
-            for (ix=0; ix<jx; ix++) {
-                res = sortsplot(list[ix], list[ix+1]);
-                if (res > 0) {
-                    tmpptr = list[ix];
-                    list[ix] = list[ix+1];
-                    list[ix+1] = tmpptr;
-                }
-            }
+    glui32 size, ix, pos;
+    int jx;
+
+    size = 16;
+    while (size < 2 * (glui32)map->numresources)
+        size *= 2;
+
+    map->reshash = (int *)giblorb_malloc(size * sizeof(int));
+    if (!map->reshash)
+        return giblorb_err_Alloc;
+    map->reshashsize = size;
+
+    for (ix=0; ix<size; ix++)
+        map->reshash[ix] = -1;
+
+    for (jx=0; jx<map->numresources; jx++) {
+        giblorb_resdesc_t *res = &(map->resources[jx]);
+        pos = giblorb_hash(res->usage, res->resnum) & (size-1);
+        while (map->reshash[pos] >= 0) {
+            giblorb_resdesc_t *other = &(map->resources[map->reshash[pos]]);
+            if (other->usage == res->usage && other->resnum == res->resnum)
+                break; /* duplicate entry; the first one wins */
+            pos = (pos+1) & (size-1);
         }
+        if (map->reshash[pos] < 0)
+            map->reshash[pos] = jx;
     }
-    else {
-        /* Split the list. */
-        pivot = list[len/2];
-        ix=0;
-        jx=len;
-        while (1) {
-            while (ix < jx-1 && sortsplot(list[ix], pivot) < 0)
-                ix++;
-            while (ix < jx-1 && sortsplot(list[jx-1], pivot) > 0)
-                jx--;
-            if (ix >= jx-1)
-                break;
-            tmpptr = list[ix];
-            list[ix] = list[jx-1];
-            list[jx-1] = tmpptr;
-        }
-        ix++;
-        /* Sort the halves. */
-        giblorb_qsort(list+0, ix);
-        giblorb_qsort(list+ix, len-ix);
+
+    return giblorb_err_None;
+}
+
+static giblorb_resdesc_t *giblorb_find_resource(giblorb_map_t *map,
+    glui32 usage, glui32 resnum)
+{
+    glui32 pos;
+
+    if (!map->reshash)
+        return NULL;
+
+    pos = giblorb_hash(usage, resnum) & (map->reshashsize-1);
+    while (map->reshash[pos] >= 0) {
+        giblorb_resdesc_t *res = &(map->resources[map->reshash[pos]]);
+        if (res->usage == usage && res->resnum == resnum)
+            return res;
+        pos = (pos+1) & (map->reshashsize-1);
     }
+
+    return NULL;
 }
 
-giblorb_resdesc_t *giblorb_bsearch(giblorb_resdesc_t *sample, 
-    giblorb_resdesc_t **list, int len)
+/* Group the chunk numbers by type, so that giblorb_load_chunk_by_type()
+    can go straight to the Nth chunk of a type. There are only ever a 
+    handful of distinct types, so the type list is searched linearly. */
+static giblorb_err_t giblorb_build_typedir(giblorb_map_t *map)
 {
-    int top, bot, val, res;
-    
-    bot = 0;
-    top = len;
-    
-    while (bot < top) {
-        val = (top+bot) / 2;
-        res = sortsplot(list[val], sample);
-        if (res == 0)
-            return list[val];
-        if (res < 0) {
-            bot = val+1;
+    int ix, jx, pos;
+
+    if (!map->numchunks)
+        return giblorb_err_None;
+
+    map->typedir = (giblorb_typedir_t *)giblorb_malloc(map->numchunks 
+        * sizeof(giblorb_typedir_t));
+    map->typechunks = (int *)giblorb_malloc(map->numchunks * sizeof(int));
+    if (!map->typedir || !map->typechunks)
+        return giblorb_err_Alloc;
+
+    /* Count the chunks of each type. */
+    for (ix=0; ix<map->numchunks; ix++) {
+        glui32 type = map->chunks[ix].type;
+        for (jx=0; jx<map->numtypes; jx++) {
+            if (map->typedir[jx].type == type)
+                break;
         }
-        else {
-            top = val;
+        if (jx >= map->numtypes) {
+            map->typedir[jx].type = type;
+            map->typedir[jx].count = 0;
+            map->numtypes++;
         }
+        map->typedir[jx].count++;
     }
-    
-    return NULL;
+
+    /* Carve up the typechunks array, then fill it in file order. */
+    pos = 0;
+    for (jx=0; jx<map->numtypes; jx++) {
+        map->typedir[jx].chunknums = map->typechunks + pos;
+        pos += map->typedir[jx].count;
+        map->typedir[jx].count = 0;
+    }
+    for (ix=0; ix<map->numchunks; ix++) {
+        glui32 type = map->chunks[ix].type;
+        for (jx=0; jx<map->numtypes; jx++) {
+            if (map->typedir[jx].type == type)
+                break;
+        }
+        map->typedir[jx].chunknums[map->typedir[jx].count] = ix;
+        map->typedir[jx].count++;
+    }
+
+    return giblorb_err_None;
 }
 
 
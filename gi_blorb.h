@@ -88,6 +88,27 @@ extern giblorb_err_t giblorb_count_resources(giblorb_map_t *map,
 extern giblorb_err_t giblorb_load_image_info(giblorb_map_t *map,
     glui32 resnum, giblorb_image_info_t *res);
 
+/* Tell the map that the entire Blorb file is available in memory (for
+    example, because the platform layer mmap()ed it). After this,
+    giblorb_method_Memory returns pointers into that block rather than
+    allocating and reading a copy of each chunk. The caller owns the
+    block and must keep it valid until the map is destroyed. Pass NULL
+    to go back to reading chunks from the file. */
+extern giblorb_err_t giblorb_set_file_memory(giblorb_map_t *map,
+    void *ptr, glui32 len);
+
+/* Save the work of giblorb_create_map(). giblorb_export_index() 
+    measures every image and then packs the chunk table, resource index,
+    and image sizes into a block allocated with malloc(). The caller
+    frees it. giblorb_create_map_from_index() builds a map for the same
+    file from such a block without reading the file. The caller is 
+    responsible for making sure the block really describes that file;
+    a block with any chunk reaching past filelen is rejected. */
+extern giblorb_err_t giblorb_export_index(giblorb_map_t *map, 
+    void **buf, glui32 *len);
+extern giblorb_err_t giblorb_create_map_from_index(strid_t file, 
+    void *buf, glui32 len, glui32 filelen, giblorb_map_t **newmap);
+
 /* The following functions are part of the Glk library itself, not 
     the Blorb layer (whose code is in gi_blorb.c). These functions 
     are necessarily implemented in platform-dependent code. 
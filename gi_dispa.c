@@ -12,6 +12,10 @@
 #include "glk.h"
 #include "gi_dispa.h"
 
+#ifdef GI_DISPA_PROFILE
+#include <time.h>
+#endif /* GI_DISPA_PROFILE */
+
 #ifndef NULL
 #define NULL 0
 #endif
@@ -25,6 +29,11 @@
 #define NUMFUNCTIONS   \
     (sizeof(function_table) / sizeof(gidispatch_function_t))
 
+/* Function ids below this are looked up through function_index, rather
+    than by searching function_table. (All the standard Glk functions are
+    well below it.) */
+#define FUNCTION_INDEX_SIZE (0x200)
+
 /* The constants in this table must be ordered alphabetically. */
 static gidispatch_intconst_t class_table[] = {
     { "fileref", (2) },   /* "Qc" */
@@ -336,6 +345,27 @@ static gidispatch_function_t function_table[] = {
 #endif /* GLK_MODULE_DATETIME */
 };
 
+/* Maps function ids to (position in function_table)+1, or zero if there
+    is no such function. Built on first use. */
+static unsigned short function_index[FUNCTION_INDEX_SIZE];
+static int function_index_ready = 0;
+
+/* Parsed prototypes, in the same order as function_table.
+    protodesc_state[ix] is 0 if that entry has not been parsed yet, 1 if
+    it has, and 2 if the function has no usable prototype. */
+static gidispatch_protodesc_t protodesc_table[NUMFUNCTIONS];
+static unsigned char protodesc_state[NUMFUNCTIONS];
+
+static void build_function_index(void);
+static int parse_prototype(char *proto, gidispatch_protodesc_t *desc);
+
+#ifdef GI_DISPA_PROFILE
+/* Call statistics, in the same order as function_table. */
+static gidispatch_profile_t profile_table[NUMFUNCTIONS];
+static void profile_record(glui32 funcnum, glui32 numargs,
+    gluniversal_t *arglist, struct timespec *start);
+#endif /* GI_DISPA_PROFILE */
+
 glui32 gidispatch_count_classes()
 {
     return NUMCLASSES;
@@ -372,10 +402,31 @@ gidispatch_function_t *gidispatch_get_function(glui32 index)
     return &(function_table[index]);
 }
 
+static void build_function_index()
+{
+    int ix;
+
+    for (ix=0; ix<NUMFUNCTIONS; ix++) {
+        glui32 id = function_table[ix].id;
+        if (id < FUNCTION_INDEX_SIZE)
+            function_index[id] = ix+1;
+    }
+    function_index_ready = 1;
+}
+
 gidispatch_function_t *gidispatch_get_function_by_id(glui32 id)
 {
     int top, bot, val;
     gidispatch_function_t *func;
+
+    if (id < FUNCTION_INDEX_SIZE) {
+        if (!function_index_ready)
+            build_function_index();
+        val = function_index[id];
+        if (!val)
+            return NULL;
+        return &(function_table[val-1]);
+    }
     
     bot = 0;
     top = NUMFUNCTIONS;
@@ -692,8 +743,410 @@ char *gidispatch_prototype(glui32 funcnum)
     }
 }
 
+/* Parse one type code ("Iu", "Qa", "[2IuIu]", etc) into desc->args,
+    starting at position *posref. Returns the string position after the
+    type, or NULL if it could not be parsed. */
+static char *parse_prototype_type(char *cx, gidispatch_protodesc_t *desc,
+    glui32 *posref, int flags)
+{
+    gidispatch_argdesc_t *arg;
+    glui32 pos = *posref;
+    glui32 ix, numfields;
+
+    if (pos >= GIDISPATCH_MAX_ARGDESCS)
+        return NULL;
+    arg = &(desc->args[pos]);
+    arg->kind = 0;
+    arg->flags = flags;
+    arg->objclass = 0;
+    arg->numfields = 0;
+    pos++;
+
+    switch (*cx) {
+        case 'I':
+            cx++;
+            if (*cx == 'u')
+                arg->kind = gidisp_Arg_UInt;
+            else if (*cx == 's')
+                arg->kind = gidisp_Arg_SInt;
+            else
+                return NULL;
+            cx++;
+            break;
+        case 'C':
+            cx++;
+            if (*cx == 'n')
+                arg->kind = gidisp_Arg_Char;
+            else if (*cx == 'u')
+                arg->kind = gidisp_Arg_UChar;
+            else if (*cx == 's')
+                arg->kind = gidisp_Arg_SChar;
+            else
+                return NULL;
+            cx++;
+            break;
+        case 'S':
+            arg->kind = gidisp_Arg_String;
+            cx++;
+            break;
+        case 'U':
+            arg->kind = gidisp_Arg_UniString;
+            cx++;
+            break;
+        case 'Q':
+            cx++;
+            if (*cx < 'a' || *cx > 'z')
+                return NULL;
+            arg->kind = gidisp_Arg_Object;
+            arg->objclass = (*cx - 'a');
+            cx++;
+            break;
+        case '[':
+            cx++;
+            numfields = 0;
+            while (*cx >= '0' && *cx <= '9') {
+                numfields = 10 * numfields + (*cx - '0');
+                cx++;
+            }
+            if (numfields > 255)
+                return NULL;
+            arg->kind = gidisp_Arg_Struct;
+            arg->numfields = numfields;
+            /* The fields follow the struct entry, and are plain values. */
+            for (ix=0; ix<numfields; ix++) {
+                cx = parse_prototype_type(cx, desc, &pos, 0);
+                if (!cx)
+                    return NULL;
+            }
+            if (*cx != ']')
+                return NULL;
+            cx++;
+            break;
+        default:
+            return NULL;
+    }
+
+    *posref = pos;
+    return cx;
+}
+
+/* Parse a prototype string into desc. Returns 1 on success, 0 if the
+    string has a form we don't understand. */
+static int parse_prototype(char *proto, gidispatch_protodesc_t *desc)
+{
+    char *cx = proto;
+    glui32 numargs = 0;
+    glui32 pos = 0;
+    glui32 firstpos;
+    glui32 minslots = 0;
+    int isreturn = 0;
+
+    desc->proto = proto;
+    desc->retdesc = -1;
+
+    if (*cx < '0' || *cx > '9')
+        return 0;
+    while (*cx >= '0' && *cx <= '9') {
+        numargs = 10 * numargs + (*cx - '0');
+        cx++;
+    }
+    desc->numargs = numargs;
+
+    while (*cx) {
+        int flags = 0;
+
+        if (*cx == ':') {
+            if (isreturn)
+                return 0;
+            isreturn = 1;
+            cx++;
+            continue;
+        }
+
+        while (1) {
+            if (*cx == '&')
+                flags |= (gidisp_ArgFlag_PassIn | gidisp_ArgFlag_PassOut);
+            else if (*cx == '<')
+                flags |= gidisp_ArgFlag_PassOut;
+            else if (*cx == '>')
+                flags |= gidisp_ArgFlag_PassIn;
+            else if (*cx == '+')
+                flags |= gidisp_ArgFlag_NonNull;
+            else if (*cx == '#')
+                flags |= gidisp_ArgFlag_Array;
+            else if (*cx == '!')
+                flags |= gidisp_ArgFlag_Retained;
+            else
+                break;
+            cx++;
+        }
+
+        if (isreturn) {
+            if (desc->retdesc >= 0)
+                return 0;
+            flags |= gidisp_ArgFlag_Return;
+            desc->retdesc = pos;
+        }
+
+        firstpos = pos;
+        cx = parse_prototype_type(cx, desc, &pos, flags);
+        if (!cx)
+            return 0;
+
+        /* A reference or return value starts with a pointer flag, and
+            has nothing more if that's null. Otherwise, an array is a
+            pointer and a length, a struct is its fields, and anything
+            else is one value. */
+        if (flags & (gidisp_ArgFlag_PassIn | gidisp_ArgFlag_PassOut
+            | gidisp_ArgFlag_Return))
+            minslots += 1;
+        else if (flags & gidisp_ArgFlag_Array)
+            minslots += 2;
+        else if (desc->args[firstpos].kind == gidisp_Arg_Struct)
+            minslots += desc->args[firstpos].numfields;
+        else
+            minslots += 1;
+    }
+
+    desc->numdescs = pos;
+    desc->minslots = minslots;
+    return 1;
+}
+
+gidispatch_protodesc_t *gidispatch_get_protodesc(glui32 funcnum)
+{
+    gidispatch_function_t *func;
+    gidispatch_protodesc_t *desc;
+    int ix;
+
+    func = gidispatch_get_function_by_id(funcnum);
+    if (!func)
+        return NULL;
+    ix = func - function_table;
+
+    if (protodesc_state[ix] == 0) {
+        char *proto = gidispatch_prototype(funcnum);
+        desc = &(protodesc_table[ix]);
+        desc->id = funcnum;
+        if (proto && parse_prototype(proto, desc))
+            protodesc_state[ix] = 1;
+        else
+            protodesc_state[ix] = 2;
+    }
+
+    if (protodesc_state[ix] != 1)
+        return NULL;
+    return &(protodesc_table[ix]);
+}
+
+/* Work out how many arglist entries a call really uses, given which of
+    its references are null. This walks the arglist the same way
+    gidispatch_call() does. If the pointer flags run past numargs, the
+    result is numargs+1. */
+static glui32 count_call_slots(gidispatch_protodesc_t *desc,
+    glui32 numargs, gluniversal_t *arglist)
+{
+    glui32 ix, pos = 0;
+
+    for (ix=0; ix<desc->numdescs; ix++) {
+        gidispatch_argdesc_t *arg = &(desc->args[ix]);
+
+        if (arg->flags & (gidisp_ArgFlag_PassIn | gidisp_ArgFlag_PassOut
+            | gidisp_ArgFlag_Return)) {
+            if (pos >= numargs)
+                return numargs+1;
+            if (!arglist[pos++].ptrflag) {
+                ix += arg->numfields;
+                continue;
+            }
+        }
+
+        if (arg->flags & gidisp_ArgFlag_Array) {
+            pos += 2;
+        }
+        else if (arg->kind == gidisp_Arg_Struct) {
+            pos += arg->numfields;
+            ix += arg->numfields;
+        }
+        else {
+            pos++;
+        }
+    }
+
+    return pos;
+}
+
+/* Make a series of calls, in order. All the calls take their arguments
+    from the one arglist array, so the caller can marshal a run of calls
+    into a single buffer and hand it over at once. Returns the number of
+    calls made. If this is less than count, calls[result] was not made,
+    because its function is unknown (or can't be dispatched) or it has
+    too few arguments for the references it passes. */
+glui32 gidispatch_call_batch(glui32 count, gidispatch_batch_t *calls,
+    gluniversal_t *arglist)
+{
+    gidispatch_protodesc_t *desc = NULL;
+    glui32 ix;
+
+    for (ix=0; ix<count; ix++) {
+        gidispatch_batch_t *call = &(calls[ix]);
+        /* Runs of the same function are common, so only look up the
+            prototype when the function changes. */
+        if (!desc || desc->id != call->funcnum) {
+            desc = gidispatch_get_protodesc(call->funcnum);
+            if (!desc)
+                return ix;
+        }
+        if (call->numargs < desc->minslots)
+            return ix;
+        if (count_call_slots(desc, call->numargs, arglist+call->argpos)
+            > call->numargs)
+            return ix;
+        gidispatch_call(call->funcnum, call->numargs, arglist+call->argpos);
+    }
+
+    return count;
+}
+
+#ifdef GI_DISPA_PROFILE
+
+gidispatch_profile_t *gidispatch_get_profile(glui32 index)
+{
+    if (index >= NUMFUNCTIONS)
+        return NULL;
+    profile_table[index].id = function_table[index].id;
+    return &(profile_table[index]);
+}
+
+void gidispatch_reset_profile()
+{
+    int ix, jx;
+
+    for (ix=0; ix<NUMFUNCTIONS; ix++) {
+        gidispatch_profile_t *prof = &(profile_table[ix]);
+        prof->calls = 0;
+        prof->nanos = 0;
+        prof->bytes = 0;
+        for (jx=0; jx<GIDISPATCH_PROFILE_BUCKETS; jx++)
+            prof->histogram[jx] = 0;
+    }
+}
+
+/* Work out how many bytes of array and string data a call passed in or
+    out. This walks the arglist the same way gidispatch_call() does, so
+    a null reference has no slots after its pointer flag. */
+static glui32 profile_count_bytes(gidispatch_protodesc_t *desc,
+    glui32 numargs, gluniversal_t *arglist)
+{
+    glui32 ix, jx, pos = 0;
+    glui32 bytes = 0;
+
+    for (ix=0; ix<desc->numdescs; ix++) {
+        gidispatch_argdesc_t *arg = &(desc->args[ix]);
+        glui32 elemsize;
+
+        if (arg->flags & (gidisp_ArgFlag_PassIn | gidisp_ArgFlag_PassOut
+            | gidisp_ArgFlag_Return)) {
+            if (pos >= numargs)
+                break;
+            if (!arglist[pos++].ptrflag) {
+                ix += arg->numfields;
+                continue;
+            }
+        }
+
+        switch (arg->kind) {
+            case gidisp_Arg_Char:
+            case gidisp_Arg_UChar:
+            case gidisp_Arg_SChar:
+                elemsize = 1;
+                break;
+            default:
+                elemsize = 4;
+                break;
+        }
+
+        if (arg->flags & gidisp_ArgFlag_Array) {
+            if (pos+1 >= numargs)
+                break;
+            bytes += elemsize * arglist[pos+1].uint;
+            pos += 2;
+        }
+        else if (arg->kind == gidisp_Arg_Struct) {
+            pos += arg->numfields;
+            ix += arg->numfields;
+        }
+        else if (arg->kind == gidisp_Arg_String) {
+            if (pos >= numargs)
+                break;
+            if (arglist[pos].charstr) {
+                for (jx=0; arglist[pos].charstr[jx]; jx++) { }
+                bytes += jx;
+            }
+            pos++;
+        }
+        else if (arg->kind == gidisp_Arg_UniString) {
+            if (pos >= numargs)
+                break;
+            if (arglist[pos].unicharstr) {
+                for (jx=0; arglist[pos].unicharstr[jx]; jx++) { }
+                bytes += 4 * jx;
+            }
+            pos++;
+        }
+        else {
+            pos++;
+        }
+    }
+
+    return bytes;
+}
+
+static void profile_record(glui32 funcnum, glui32 numargs,
+    gluniversal_t *arglist, struct timespec *start)
+{
+    struct timespec end;
+    gidispatch_function_t *func;
+    gidispatch_protodesc_t *desc;
+    gidispatch_profile_t *prof;
+    unsigned long long nanos;
+    int bucket;
+
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    func = gidispatch_get_function_by_id(funcnum);
+    if (!func)
+        return;
+    prof = &(profile_table[func - function_table]);
+
+    nanos = (unsigned long long)(end.tv_sec - start->tv_sec) * 1000000000
+        + end.tv_nsec - start->tv_nsec;
+    prof->calls++;
+    prof->nanos += nanos;
+
+    /* Bucket n holds calls that took from 2^n up to 2^(n+1) nanoseconds.
+        (Bucket 0 also holds calls that took no measurable time.) */
+    bucket = 0;
+    while (nanos > 1 && bucket < GIDISPATCH_PROFILE_BUCKETS-1) {
+        nanos >>= 1;
+        bucket++;
+    }
+    prof->histogram[bucket]++;
+
+    desc = gidispatch_get_protodesc(funcnum);
+    if (desc)
+        prof->bytes += profile_count_bytes(desc, numargs, arglist);
+}
+
+#endif /* GI_DISPA_PROFILE */
+
 void gidispatch_call(glui32 funcnum, glui32 numargs, gluniversal_t *arglist)
 {
+#ifdef GI_DISPA_PROFILE
+    struct timespec profstart;
+    clock_gettime(CLOCK_MONOTONIC, &profstart);
+#endif /* GI_DISPA_PROFILE */
+
     switch (funcnum) {
         case 0x0001: /* exit */
             glk_exit();
@@ -1533,6 +1986,10 @@ void gidispatch_call(glui32 funcnum, glui32 numargs, gluniversal_t *arglist)
             /* do nothing */
             break;
     }
+
+#ifdef GI_DISPA_PROFILE
+    profile_record(funcnum, numargs, arglist, &profstart);
+#endif /* GI_DISPA_PROFILE */
 }
 
 #ifdef GI_DISPA_GAME_ID_AVAILABLE
@@ -44,6 +44,72 @@ typedef struct gidispatch_function_struct {
     char *name;
 } gidispatch_function_t;
 
+/* A prototype string, parsed once so that the caller doesn't have to
+    do it on every call. gidispatch_get_protodesc() returns one of these,
+    or NULL if the function has no prototype (or isn't in the function
+    table). The structure belongs to the dispatch layer; don't modify it. */
+#define gidisp_Arg_UInt (1)       /* Iu */
+#define gidisp_Arg_SInt (2)       /* Is */
+#define gidisp_Arg_Char (3)       /* Cn */
+#define gidisp_Arg_UChar (4)      /* Cu */
+#define gidisp_Arg_SChar (5)      /* Cs */
+#define gidisp_Arg_String (6)     /* S */
+#define gidisp_Arg_UniString (7)  /* U */
+#define gidisp_Arg_Object (8)     /* Qa, Qb, Qc... */
+#define gidisp_Arg_Struct (9)     /* [ ... ] */
+
+#define gidisp_ArgFlag_PassIn (0x01)    /* & or > */
+#define gidisp_ArgFlag_PassOut (0x02)   /* & or < */
+#define gidisp_ArgFlag_NonNull (0x04)   /* + */
+#define gidisp_ArgFlag_Array (0x08)     /* # */
+#define gidisp_ArgFlag_Retained (0x10)  /* ! */
+#define gidisp_ArgFlag_Return (0x20)    /* after the colon */
+
+typedef struct gidispatch_argdesc_struct {
+    unsigned char kind; /* gidisp_Arg_* */
+    unsigned char flags; /* gidisp_ArgFlag_* */
+    unsigned char objclass; /* for gidisp_Arg_Object: 0 for Qa, etc */
+    unsigned char numfields; /* for gidisp_Arg_Struct: the fields are the
+        next numfields entries in the list */
+} gidispatch_argdesc_t;
+
+#define GIDISPATCH_MAX_ARGDESCS (24)
+
+typedef struct gidispatch_protodesc_struct {
+    glui32 id;
+    char *proto; /* the prototype string this was parsed from */
+    glui32 numargs; /* the leading number in the prototype string */
+    glui32 numdescs; /* entries used in args, including struct fields */
+    int retdesc; /* position of the return value in args, or -1 */
+    glui32 minslots; /* the fewest arglist entries a call can use (with
+        every optional reference null) */
+    gidispatch_argdesc_t args[GIDISPATCH_MAX_ARGDESCS];
+} gidispatch_protodesc_t;
+
+/* One call in a batch. Its arguments are arglist[argpos] to
+    arglist[argpos+numargs-1], where arglist is the array passed to
+    gidispatch_call_batch(). */
+typedef struct gidispatch_batch_struct {
+    glui32 funcnum;
+    glui32 argpos;
+    glui32 numargs;
+} gidispatch_batch_t;
+
+#ifdef GI_DISPA_PROFILE
+/* Call statistics for one function, kept when the dispatch layer is
+    compiled with GI_DISPA_PROFILE defined. Bucket n of the histogram
+    counts calls that took from 2^n to 2^(n+1) nanoseconds. bytes is the
+    total size of the arrays and strings passed in or out. */
+#define GIDISPATCH_PROFILE_BUCKETS (32)
+typedef struct gidispatch_profile_struct {
+    glui32 id;
+    unsigned long long calls;
+    unsigned long long nanos;
+    unsigned long long bytes;
+    glui32 histogram[GIDISPATCH_PROFILE_BUCKETS];
+} gidispatch_profile_t;
+#endif /* GI_DISPA_PROFILE */
+
 typedef struct gidispatch_intconst_struct {
     char *name;
     glui32 val;
@@ -86,6 +152,9 @@ extern void gidispatch_set_autorestore_registry(
 extern void gidispatch_call(glui32 funcnum, glui32 numargs, 
     gluniversal_t *arglist);
 extern char *gidispatch_prototype(glui32 funcnum);
+extern gidispatch_protodesc_t *gidispatch_get_protodesc(glui32 funcnum);
+extern glui32 gidispatch_call_batch(glui32 count, gidispatch_batch_t *calls,
+    gluniversal_t *arglist);
 extern glui32 gidispatch_count_classes(void);
 extern gidispatch_intconst_t *gidispatch_get_class(glui32 index);
 extern glui32 gidispatch_count_intconst(void);
@@ -93,6 +162,11 @@ extern gidispatch_intconst_t *gidispatch_get_intconst(glui32 index);
 extern glui32 gidispatch_count_functions(void);
 extern gidispatch_function_t *gidispatch_get_function(glui32 index);
 extern gidispatch_function_t *gidispatch_get_function_by_id(glui32 id);
+#ifdef GI_DISPA_PROFILE
+/* The profile for gidispatch_get_function(index). */
+extern gidispatch_profile_t *gidispatch_get_profile(glui32 index);
+extern void gidispatch_reset_profile(void);
+#endif /* GI_DISPA_PROFILE */
 
 #define GI_DISPA_GAME_ID_AVAILABLE
 /* These function is not part of Glk dispatching per se; they allow the
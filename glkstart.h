@@ -94,6 +94,7 @@ typedef struct glkunix_library_state_struct *glkunix_library_state_t;
 typedef union glk_objrock_union glk_objrock_u;
 
 extern void glkunix_save_library_state(strid_t file, strid_t omitstream, glkunix_serialize_object_f extra_state_func, void *extra_state_rock);
+extern void glkunix_save_library_state_limit(strid_t file, strid_t omitstream, glkunix_serialize_object_f extra_state_func, void *extra_state_rock, long maxparas, long maxchars);
 extern glkunix_library_state_t glkunix_load_library_state(strid_t file, glkunix_unserialize_object_f extra_state_func, void *extra_state_rock);
 extern glui32 glkunix_update_from_library_state(glkunix_library_state_t state);
 extern void glkunix_library_state_free(glkunix_library_state_t state);
@@ -0,0 +1,292 @@
+#!/usr/bin/env python3
+
+# Run many RemGlk sessions at once, to see how many a machine can carry.
+#
+#   python3 loadgen.py [options] -- game [args ...]
+#   python3 loadgen.py [options] --transcript FILE [-- game [args ...]]
+#
+# This starts N copies of the game and drives them all over pipes from
+# one process; there's no network involved. Each session waits a "think
+# time" between receiving an update and sending the next input, as a
+# player would. Sessions start at staggered times, spread over one think
+# time, so that they don't all move in lockstep.
+#
+# There are two ways to drive a session:
+#
+# - Scripted: send the init event, and answer each update with a line
+#   input in the first window that wants one. The commands are taken in
+#   turn from --script FILE (one per line), or are all "look". A session
+#   stops after --turns inputs, or when the game exits.
+#
+# - Recorded: with --transcript, replay the input of a session recorded
+#   by transcript.py. (The recorded command is used unless you give
+#   another; it includes -windowbase, so the recorded window ids are
+#   still right.) The output is not checked; use transcript.py for that.
+#
+# At the end we report the aggregate throughput (turns per second over
+# all sessions), the latency of each turn (from sending an input to
+# receiving the complete update) as percentiles, and the CPU time and
+# peak RSS of each session. This script's own CPU time is reported too,
+# because with many sessions and a short think time it can become the
+# bottleneck. This only works on Linux (peak RSS comes from /proc).
+
+import sys
+import os
+import json
+import time
+import random
+import selectors
+import optparse
+import resource
+import subprocess
+
+popt = optparse.OptionParser(usage='loadgen.py [options] -- game [args ...]')
+popt.add_option('-n', '--sessions', action='store', type=int, dest='sessions', default=10,
+                help='number of sessions to run at once (default 10)')
+popt.add_option('--think', action='store', type=float, dest='think', default=1.0,
+                help='mean think time between turns, in seconds (default 1.0)')
+popt.add_option('--jitter', action='store', type=float, dest='jitter', default=50.0,
+                help='random variation in think time, in percent (default 50)')
+popt.add_option('--turns', action='store', type=int, dest='turns', default=50,
+                help='(scripted) inputs to send per session (default 50)')
+popt.add_option('--script', action='store', dest='script',
+                help='(scripted) file of commands to send, one per line')
+popt.add_option('--transcript', action='store', dest='transcript',
+                help='replay the input of this transcript in each session')
+popt.add_option('--width', action='store', type=int, dest='width', default=800,
+                help='(scripted) screen width for the init event (default 800)')
+popt.add_option('--height', action='store', type=int, dest='height', default=600,
+                help='(scripted) screen height for the init event (default 600)')
+popt.add_option('--seed', action='store', type=int, dest='seed', default=1,
+                help='seed for the think-time jitter (default 1)')
+
+(opts, args) = popt.parse_args()
+
+class Session:
+    """One running game, and where we are in driving it."""
+
+    def __init__(self, index, command, inputs):
+        self.index = index
+        self.proc = subprocess.Popen(command, stdin=subprocess.PIPE, stdout=subprocess.PIPE)
+        self.outfd = self.proc.stdout.fileno()
+        os.set_blocking(self.outfd, False)
+        self.buf = bytearray()
+        self.inputs = inputs  # list of (data, expected output bytes), or None
+        self.inpos = 0
+        self.outcount = 0
+        self.turns = 0
+        self.sentat = None
+        self.started = False
+        self.sendat = None
+        self.pending = None
+        self.latencies = []
+        self.peakrss = 0
+        self.done = False
+        self.cpu = 0.0
+
+    def send(self, data, now):
+        """Send an input. The first one is the init event, which isn't
+        counted as a turn, since its latency includes starting up."""
+        try:
+            self.proc.stdin.write(data)
+            self.proc.stdin.flush()
+        except BrokenPipeError:
+            # The game has died; we'll see end-of-file on its output.
+            return
+        if self.started:
+            self.sentat = now
+            self.turns += 1
+        self.started = True
+
+    def poll_rss(self):
+        try:
+            with open('/proc/%d/status' % (self.proc.pid,)) as fl:
+                for ln in fl:
+                    if ln.startswith('VmHWM:'):
+                        self.peakrss = max(self.peakrss, int(ln.split()[1]))
+        except (IOError, ValueError):
+            pass
+
+    def finish(self):
+        if self.done:
+            return
+        self.done = True
+        try:
+            self.proc.stdin.close()
+        except IOError:
+            pass
+        (pid, status, usage) = os.wait4(self.proc.pid, 0)
+        self.proc.returncode = status
+        self.proc.stdout.close()
+        self.cpu = usage.ru_utime + usage.ru_stime
+
+def think_time():
+    spread = opts.think * opts.jitter / 100.0
+    return max(0.0, opts.think + rng.uniform(-spread, spread))
+
+def turn_complete(sess, now):
+    """The session has received the whole response to its last input.
+    Record the latency and decide what to send next (after thinking)."""
+    if sess.sentat is not None:
+        sess.latencies.append(now - sess.sentat)
+        sess.sentat = None
+    sess.poll_rss()
+
+    if sess.inputs is not None:
+        if sess.inpos >= len(sess.inputs):
+            return False
+        sess.pending = sess.inputs[sess.inpos][0]
+        return True
+
+    # Scripted: parse the update to find the input request.
+    text = bytes(sess.buf).strip()
+    sess.buf.clear()
+    if not text:
+        return False
+    update = json.loads(text)
+    if update.get('type') == 'error' or update.get('exit'):
+        return False
+    if sess.turns >= opts.turns:
+        return False
+    reqs = [ req for req in update.get('input', []) if req.get('type') == 'line' ]
+    if not reqs:
+        return False
+    cmd = script[sess.turns % len(script)]
+    event = { 'type':'line', 'gen':update['gen'], 'window':reqs[0]['id'], 'value':cmd }
+    sess.pending = (json.dumps(event) + '\n').encode()
+    return True
+
+def scripted_init():
+    event = { 'type':'init', 'gen':0,
+              'metrics': { 'width':opts.width, 'height':opts.height, 'charwidth':10, 'charheight':20 },
+              'support': [ 'timer', 'hyperlinks', 'graphics', 'graphicswin' ] }
+    return (json.dumps(event) + '\n').encode()
+
+def load_transcript(path):
+    """Read a transcript.py file. Return the command, and a list of
+    (input, total output bytes expected after it) pairs."""
+    with open(path) as fl:
+        header = json.loads(fl.readline())
+        if header.get('transcript') != 1:
+            popt.error('not a transcript file: ' + path)
+        inputs = []
+        outtotal = 0
+        for ln in fl:
+            entry = json.loads(ln)
+            if 'in' in entry:
+                inputs.append([ entry['in'].encode('latin-1'), outtotal ])
+            elif 'out' in entry:
+                outtotal += len(entry['out'].encode('latin-1'))
+                if inputs:
+                    inputs[-1][1] = outtotal
+    return (header['command'], [ tuple(val) for val in inputs ])
+
+def percentile(vals, pc):
+    """Nearest-rank percentile of a sorted list."""
+    pos = (len(vals) * pc + 99) // 100
+    return vals[max(pos, 1) - 1]
+
+rng = random.Random(opts.seed)
+inputs = None
+command = args
+if opts.transcript:
+    (reccommand, inputs) = load_transcript(opts.transcript)
+    if not command:
+        command = reccommand
+if not command:
+    popt.error('no game command given')
+script = [ 'look' ]
+if opts.script:
+    with open(opts.script) as fl:
+        script = [ ln.rstrip('\n') for ln in fl if ln.strip() ] or script
+
+sel = selectors.DefaultSelector()
+sessions = []
+starttime = time.monotonic()
+for ix in range(opts.sessions):
+    sess = Session(ix, command, inputs)
+    if inputs is not None:
+        sess.pending = (inputs[0][0] if inputs else None)
+    else:
+        sess.pending = scripted_init()
+    sess.sendat = starttime + opts.think * ix / opts.sessions
+    sel.register(sess.outfd, selectors.EVENT_READ, sess)
+    sessions.append(sess)
+
+live = len(sessions)
+while live:
+    now = time.monotonic()
+    # Send whatever is due, and work out how long we can sleep.
+    timeout = None
+    for sess in sessions:
+        if sess.done or sess.pending is None:
+            continue
+        if sess.sendat <= now:
+            sess.send(sess.pending, now)
+            sess.pending = None
+            if sess.inputs is not None:
+                sess.inpos += 1
+                if sess.outcount >= sess.inputs[sess.inpos-1][1]:
+                    # The recording had no output for this input.
+                    if turn_complete(sess, now):
+                        sess.sendat = now + think_time()
+                    else:
+                        sess.finish()
+                        sel.unregister(sess.outfd)
+                        live -= 1
+        else:
+            wait = sess.sendat - now
+            if timeout is None or wait < timeout:
+                timeout = wait
+
+    for (key, events) in sel.select(timeout):
+        sess = key.data
+        now = time.monotonic()
+        try:
+            data = os.read(sess.outfd, 65536)
+        except BlockingIOError:
+            continue
+        if not data:
+            sel.unregister(sess.outfd)
+            if sess.sentat is not None:
+                sess.latencies.append(now - sess.sentat)
+            sess.finish()
+            live -= 1
+            continue
+        sess.outcount += len(data)
+        sess.buf.extend(data)
+        if sess.inputs is not None:
+            # Recorded: the turn is over when we've seen as much output
+            # as the recording had before the next input.
+            if not sess.inpos or sess.outcount < sess.inputs[sess.inpos-1][1]:
+                continue
+            sess.buf.clear()
+        elif not sess.buf.endswith(b'\n\n'):
+            continue
+        if turn_complete(sess, now):
+            sess.sendat = now + think_time()
+        else:
+            sess.finish()
+            sel.unregister(sess.outfd)
+            live -= 1
+
+elapsed = time.monotonic() - starttime
+selfusage = resource.getrusage(resource.RUSAGE_SELF)
+
+latencies = sorted([ val for sess in sessions for val in sess.latencies ])
+turns = sum([ sess.turns for sess in sessions ])
+cpus = sorted([ sess.cpu for sess in sessions ])
+rsses = sorted([ sess.peakrss for sess in sessions ])
+
+print('sessions:    %d, think time %.3f s' % (len(sessions), opts.think))
+print('elapsed:     %.2f s' % (elapsed,))
+print('turns:       %d (%.1f turns/sec)' % (turns, turns / max(elapsed, 1.0e-6)))
+if latencies:
+    print('latency:     p50 %.2f ms, p90 %.2f ms, p99 %.2f ms, max %.2f ms' % (
+        1000*percentile(latencies, 50), 1000*percentile(latencies, 90),
+        1000*percentile(latencies, 99), 1000*latencies[-1]))
+print('session CPU: mean %.3f s, max %.3f s, total %.3f s (%.2f cores)' % (
+    sum(cpus) / len(cpus), cpus[-1], sum(cpus), sum(cpus) / max(elapsed, 1.0e-6)))
+print('session RSS: mean %d KB, max %d KB, total %d KB' % (
+    sum(rsses) // len(rsses), rsses[-1], sum(rsses)))
+print('driver CPU:  %.3f s' % (selfusage.ru_utime + selfusage.ru_stime,))
@@ -22,6 +22,18 @@ int pref_autometrics = FALSE;
 int pref_gamefiledir = FALSE;
 int pref_onlyfiledir = FALSE;
 int pref_singleturn = FALSE;
+int pref_autosaveparas = 0;
+int pref_autosavechars = 0;
+int pref_turnchars = 0;
+int pref_windowbase = 0;
+char *pref_fastforwardpath = NULL;
+int pref_mmapresources = FALSE;
+char *pref_blorbcachedir = NULL;
+#ifdef GI_DISPA_PROFILE
+char *pref_profilepath = NULL;
+#endif /* GI_DISPA_PROFILE */
+char *pref_turnstatspath = NULL;
+char *pref_tracepath = NULL;
 static int pref_screenwidth = 80;
 static int pref_screenheight = 50;
 static data_supportcaps_t pref_supportcaps;
@@ -36,6 +48,7 @@ typedef struct dataresource_struct {
     char *pathname;
     int len;
     void *ptr;
+    int mapped; /* ptr is an mmap()ed view of the file, not malloc'd */
 } dataresource_t;
 static dataresource_t *dataresources = NULL;
 static int numdataresources = 0, dataresource_size = 0;
@@ -181,6 +194,8 @@ int main(int argc, char *argv[])
             pref_autometrics = val;
         else if (extract_value(argc, argv, "am", ex_Bool, &ix, &val, FALSE))
             pref_autometrics = val;
+        else if (extract_value(argc, argv, "windowbase", ex_Int, &ix, &val, 0))
+            pref_windowbase = val; /* must come before "w" */
         else if (extract_value(argc, argv, "width", ex_Int, &ix, &val, 80))
             pref_screenwidth = val;
         else if (extract_value(argc, argv, "w", ex_Int, &ix, &val, 80))
@@ -195,6 +210,26 @@ int main(int argc, char *argv[])
             pref_singleturn = val;
         else if (extract_value(argc, argv, "stderr", ex_Bool, &ix, &val, FALSE))
             pref_stderr = val;
+        else if (extract_value(argc, argv, "mmap", ex_Bool, &ix, &val, FALSE))
+            pref_mmapresources = val;
+        else if (extract_value(argc, argv, "blorbcache", ex_Str, &ix, &val, FALSE))
+            pref_blorbcachedir = strdup(extracted_string);
+        else if (extract_value(argc, argv, "turnstats", ex_Str, &ix, &val, FALSE))
+            pref_turnstatspath = strdup(extracted_string);
+        else if (extract_value(argc, argv, "trace", ex_Str, &ix, &val, FALSE))
+            pref_tracepath = strdup(extracted_string);
+        else if (extract_value(argc, argv, "fastforward", ex_Str, &ix, &val, FALSE))
+            pref_fastforwardpath = strdup(extracted_string);
+#ifdef GI_DISPA_PROFILE
+        else if (extract_value(argc, argv, "profile", ex_Str, &ix, &val, FALSE))
+            pref_profilepath = strdup(extracted_string);
+#endif /* GI_DISPA_PROFILE */
+        else if (extract_value(argc, argv, "autosaveparas", ex_Int, &ix, &val, 0))
+            pref_autosaveparas = val;
+        else if (extract_value(argc, argv, "autosavechars", ex_Int, &ix, &val, 0))
+            pref_autosavechars = val;
+        else if (extract_value(argc, argv, "turnchars", ex_Int, &ix, &val, 0))
+            pref_turnchars = val;
         else if (extract_value(argc, argv, "support", ex_Str, &ix, &val, FALSE)) {
             if (!strcmp(extracted_string, "timer") || !strcmp(extracted_string, "timers"))
                 pref_supportcaps.timer = TRUE;
@@ -206,6 +241,10 @@ int main(int argc, char *argv[])
                 pref_supportcaps.graphicswin = TRUE;
             else if (!strcmp(extracted_string, "graphicsext"))
                 pref_supportcaps.graphicsext = TRUE;
+            else if (!strcmp(extracted_string, "partialwindows"))
+                pref_supportcaps.partialwindows = TRUE;
+            else if (!strcmp(extracted_string, "partialupdates"))
+                pref_supportcaps.partialupdates = TRUE;
             else {
                 printf("%s: -support value not recognized: %s\n", argv[0], extracted_string);
                 errflag = TRUE;
@@ -274,7 +313,7 @@ int main(int argc, char *argv[])
         printf("  -autometrics BOOL: allow screen size to be set during autorestore (default 'no')\n");
         printf("  -width NUM: manual screen width (default 80)\n");
         printf("  -height NUM: manual screen height (default 50)\n");
-        printf("  -support [timer, hyperlinks, graphics, graphicswin, graphicsext]: declare support for various input features\n");
+        printf("  -support [timer, hyperlinks, graphics, graphicswin, graphicsext, partialwindows, partialupdates]: declare support for various input features\n");
         printf("  -filedir STR: default directory for save files\n");
         printf("  -gamefiledir BOOL: use the game file directory as the default directory for save files\n");
         printf("  -onlyfiledir BOOL: enforce the default directory for save files\n");
@@ -284,6 +323,18 @@ int main(int argc, char *argv[])
         printf("     (file is considered binary by default, or text if -dataresourcetext is used)\n");
         printf("  -singleturn BOOL: exit the process after responding to one input (default 'no')\n");
         printf("  -stderr BOOL: send errors to stderr rather than stdout (default 'no')\n");
+        printf("  -mmap BOOL: map the blorb file and data resource files into memory, rather than reading copies of them (default 'no')\n");
+        printf("  -blorbcache STR: directory in which to cache parsed blorb indexes, for sharing between sessions\n");
+        printf("  -turnstats STR: file to write per-turn timing statistics to, one JSON line per turn, with percentiles at exit\n");
+        printf("  -trace STR: file to write a Chrome trace-event log of waits, updates, autosaves, and file I/O to\n");
+#ifdef GI_DISPA_PROFILE
+        printf("  -profile STR: file to write dispatch call statistics to, at exit or on SIGUSR1 (default: stderr)\n");
+#endif /* GI_DISPA_PROFILE */
+        printf("  -fastforward STR: read input from this file before stdin, sending no output until it runs out\n");
+        printf("  -windowbase NUM: give the first window this id, rather than a random one, so that the output is repeatable (default 0, random)\n");
+        printf("  -autosaveparas NUM: keep at most this many paragraphs of each buffer window in autosaves (default 0, no limit)\n");
+        printf("  -autosavechars NUM: keep at most this many characters of each buffer window in autosaves (default 0, no limit)\n");
+        printf("  -turnchars NUM: let at most this many characters of output pile up in a buffer window before the next update (default 0, no limit)\n");
 #if GIDEBUG_LIBRARY_SUPPORT
         printf("  -D: turn on debug console\n");
 #endif /* GIDEBUG_LIBRARY_SUPPORT */
@@ -306,6 +357,13 @@ int main(int argc, char *argv[])
     gli_initialize_streams();
     gli_initialize_filerefs();
     gli_initialize_events();
+    if (pref_tracepath)
+        gli_initialize_trace(pref_tracepath);
+    if (pref_fastforwardpath)
+        gli_initialize_fastforward(pref_fastforwardpath);
+#ifdef GI_DISPA_PROFILE
+    gli_initialize_profile();
+#endif /* GI_DISPA_PROFILE */
 
     inittime = TRUE;
     if (!glkunix_startup_code(&startdata)) {
@@ -333,6 +391,9 @@ int main(int argc, char *argv[])
     if (gli_debugger)
         gidebug_announce_cycle(gidebug_cycle_Start);
 
+    if (pref_turnstatspath)
+        gli_initialize_turnstats(pref_turnstatspath);
+
     /* Call the program main entry point, and then exit. */
     glk_main();
     glk_exit();
@@ -490,6 +551,7 @@ static int add_dataresource(char *progname, char *str, int isbinary)
     dataresources[numdataresources].pathname = strdup(sep);
     dataresources[numdataresources].ptr = NULL;
     dataresources[numdataresources].len = 0;
+    dataresources[numdataresources].mapped = FALSE;
     numdataresources++;
     return TRUE;
 }
@@ -535,7 +597,8 @@ static char *construct_resourceurl(char *str, int ispath)
    if any).
    The data is read from the given pathname and stashed in memory.
    This is memory-hoggish, but so is the rest of glk_stream_open_resource();
-   see comments there.
+   see comments there. With the -mmap option, the file is mapped instead,
+   so the pages are shared with anyone else reading the same file.
    (You might wonder why we don't call gli_stream_open_pathname() and
    handle the file as a file-based stream. Turns out that doesn't work;
    the handling of unicode streams is subtly different for resource
@@ -560,6 +623,21 @@ int gli_get_dataresource_info(int num, void **ptr, glui32 *len, int *isbinary)
                     gli_strict_warning("stream_open_resource: unable to read given pathname.");
                     return FALSE;
                 }
+                if (pref_mmapresources) {
+                    glui32 maplen;
+                    void *mapptr = gli_map_file(fl, &maplen);
+                    if (mapptr) {
+                        fclose(fl);
+                        dataresources[ix].ptr = mapptr;
+                        dataresources[ix].len = maplen;
+                        dataresources[ix].mapped = TRUE;
+                        *ptr = dataresources[ix].ptr;
+                        *len = dataresources[ix].len;
+                        return TRUE;
+                    }
+                    /* Couldn't map it (empty file, perhaps); fall back
+                       to reading it. */
+                }
                 fseek(fl, 0, SEEK_END);
                 dataresources[ix].len = ftell(fl);
                 if (dataresources[ix].len < 0) {
@@ -50,6 +50,7 @@ typedef struct data_content_struct data_content_t;
 typedef struct data_specialreq_struct data_specialreq_t;
 typedef struct data_tempbufinfo_struct data_tempbufinfo_t;
 typedef struct data_supportcaps_struct data_supportcaps_t;
+typedef struct data_subscription_struct data_subscription_t;
 
 typedef struct glk_window_struct window_t;
 typedef struct glk_stream_struct stream_t;
@@ -66,6 +67,7 @@ struct glk_window_struct {
     glui32 updatetag; /* numeric tag for the window in output and autosave */
     
     grect_t bbox; /* content rectangle, excluding borders */
+    int geometry_dirty; /* bbox or grid size changed since the last update */
     window_t *parent; /* pair window which contains this one */
     void *data; /* one of the window_*_t structures */
     
@@ -117,6 +119,13 @@ struct glk_stream_struct {
     glui32 lastop; /* 0, filemode_Write, or filemode_Read */
     char *filename; /* only needed for autosave */
     char *modestr; /* only needed for autosave */
+
+    /* for strtype_File, unicode only: encoded bytes which have not yet
+       been written (if lastop is Write), or which have been read but
+       not yet decoded (if lastop is Read). filebufpos is only used when
+       reading. */
+    unsigned char *filebuf;
+    glui32 filebufpos, filebuflen;
     
     /* for strtype_File, strtype_Resource */
     int isbinary;
@@ -166,7 +175,7 @@ extern window_t *gli_focuswin;
 extern stream_t *gli_currentstr;
 extern void (*gli_interrupt_handler)(void);
 
-/* The following typedefs are copied from cheapglk.h. They support the
+/* The following typedefs are adapted from cheapglk.h. They support the
    tables declared in cgunigen.c. */
 
 typedef glui32 gli_case_block_t[2]; /* upper, lower */
@@ -177,9 +186,9 @@ typedef glui32 gli_case_special_t[3]; /* upper, lower, title */
    (in cgunicode.c). In that subarray, element zero is the length,
    and that's followed by length unicode values. */
 
-typedef glui32 gli_decomp_block_t[2]; /* count, position */
-/* The position points to a subarray of the unigen_decomp_array.
-   If the count is zero, there is no decomposition. */
+/* Decompositions are stored in unigen_decomp_data as a count followed
+   by that many characters. The decomposition tables hold offsets into
+   that array; offset zero has a count of zero (no decomposition). */
 
 
 extern gidispatch_rock_t (*gli_register_obj)(void *obj, glui32 objclass);
@@ -193,7 +202,19 @@ extern int pref_stderr;
 extern int pref_singleturn;
 extern int pref_gamefiledir;
 extern int pref_onlyfiledir;
+extern int pref_autosaveparas;
+extern int pref_autosavechars;
+extern int pref_turnchars;
+extern int pref_windowbase;
+extern char *pref_fastforwardpath;
+extern int pref_mmapresources;
+extern char *pref_blorbcachedir;
 extern char *pref_resourceurl;
+#ifdef GI_DISPA_PROFILE
+extern char *pref_profilepath;
+#endif /* GI_DISPA_PROFILE */
+extern char *pref_turnstatspath;
+extern char *pref_tracepath;
 
 extern int gli_get_dataresource_info(int num, void **ptr, glui32 *len, int *isbinary);
 
@@ -216,7 +237,7 @@ extern void gli_msgline_redraw(void);
 extern int gli_msgin_getline(char *prompt, char *buf, int maxlen, int *length);
 extern int gli_msgin_getchar(char *prompt, int hilite);
 
-extern void gli_putchar_utf8(glui32 val, FILE *fl);
+extern int gli_putchar_utf8(glui32 val, FILE *fl);
 extern glui32 gli_parse_utf8(unsigned char *buf, glui32 buflen,
     glui32 *out, glui32 outlen);
 extern int gli_encode_utf8(glui32 val, char *buf, int len);
@@ -234,6 +255,44 @@ extern void gli_initialize_windows(void);
 extern void gli_fast_exit(void) GLK_ATTRIBUTE_NORETURN;
 extern void gli_display_warning(char *msg);
 extern void gli_display_error(char *msg) GLK_ATTRIBUTE_NORETURN;
+extern void *gli_map_file(FILE *fl, glui32 *len);
+extern void gli_unmap_file(void *ptr, glui32 len);
+/* The phases of a turn, for -turnstats. */
+#define gli_phase_Compute (0)
+#define gli_phase_Build (1)
+#define gli_phase_Serialize (2)
+#define gli_phase_Flush (3)
+#define gli_phase_Wait (4)
+#define gli_phase_Parse (5)
+#define gli_phase_Trim (6)
+#define gli_phase_Count (7)
+
+/* Is -turnstats on? Check this before calling the functions below. */
+extern int gli_turnstats;
+extern void gli_initialize_turnstats(char *pathname);
+extern void gli_turnstats_begin(int phase);
+extern void gli_turnstats_end(int phase);
+extern int gli_turnstats_switch(int fromphase, int tophase);
+extern void gli_turnstats_end_turn(void);
+extern void gli_turnstats_finish(void);
+
+/* Is -fastforward input still being read? (While it is, updates are
+   not sent.) */
+extern int gli_fastforwarding;
+
+/* Is -trace on? Check this before calling the functions below. */
+extern int gli_tracing;
+extern void gli_initialize_trace(char *pathname);
+extern unsigned long long gli_trace_now(void);
+extern void gli_trace_span(char *name, char *cat, unsigned long long start);
+extern void gli_trace_flush(void);
+extern void gli_trace_finish(void);
+
+#ifdef GI_DISPA_PROFILE
+extern void gli_initialize_profile(void);
+extern int gli_profile_write(void);
+extern void gli_profile_poll(void);
+#endif /* GI_DISPA_PROFILE */
 extern glui32 gli_window_current_generation(void);
 extern winid_t glkunix_window_find_by_updatetag(glui32 tag); /* see glkstart.h */
 extern window_t *gli_new_window(glui32 type, glui32 rock);
@@ -244,7 +303,10 @@ extern int gli_windows_update_from_state(window_t **list, int count, window_t *r
 extern window_t *gli_window_iterate_treeorder(window_t *win);
 extern void gli_window_rearrange(window_t *win, grect_t *box, data_metrics_t *metrics);
 extern void gli_windows_update(data_specialreq_t *special, int newgeneration, int gameover);
+extern void gli_windows_update_partial(void);
 extern void gli_windows_refresh(glui32 fromgen);
+extern void gli_windows_subscribe(data_subscription_t *newsub);
+extern data_subscription_t *gli_windows_get_subscription(void);
 extern void gli_windows_metrics_change(data_metrics_t *newmetrics);
 extern data_metrics_t *gli_windows_get_metrics(void);
 extern void gli_windows_update_metrics(data_metrics_t *newmetrics);
@@ -274,6 +336,7 @@ extern void gli_stream_fill_result(stream_t *str,
 extern void gli_stream_echo_line(stream_t *str, char *buf, glui32 len);
 extern void gli_stream_echo_line_uni(stream_t *str, glui32 *buf, glui32 len);
 extern void gli_streams_close_all(void);
+extern void gli_streams_flush_all(void);
 
 extern void gli_initialize_filerefs(void);
 extern void gli_fileref_set_working_dir(char *filename);
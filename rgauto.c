@@ -19,15 +19,23 @@
 
 #define SERIAL_VERSION (1)
 
-static void window_state_print(FILE *fl, winid_t win);
+static void window_state_print(FILE *fl, winid_t win, long maxparas, long maxchars);
 static void stream_state_print(FILE *fl, strid_t str);
 static void fileref_state_print(FILE *fl, frefid_t fref);
 static int window_state_parse(glkunix_library_state_t state, glkunix_unserialize_context_t entry, winid_t win);
 static int stream_state_parse(glkunix_library_state_t state, glkunix_unserialize_context_t entry, strid_t str);
 static int fileref_state_parse(glkunix_library_state_t state, glkunix_unserialize_context_t entry, frefid_t fref);
-static void tbrun_print(FILE *fl, tbrun_t *run);
+static int textbuffer_contents_parse(window_textbuffer_t *dwin, glkunix_unserialize_context_t entry);
+static long textbuffer_save_start(window_textbuffer_t *dwin, long maxparas, long maxchars);
+static void textbuffer_contents_print(FILE *fl, window_textbuffer_t *dwin, long maxparas, long maxchars);
+static void tbrun_print(FILE *fl, tbrun_t *run, long cnum, long specnum);
 static void tgline_print(FILE *fl, tgline_t *line, int width);
 
+/* The contents of a buffer window. When an autosave is loaded, these
+   fields are read only as JSON text; they aren't decoded until the
+   window needs them. */
+static char *textbuffer_deferkeys[] = { "buf_chars", "buf_runs", "buf_specials", NULL };
+
 static window_t *libstate_window_find_by_updatetag(glkunix_library_state_t state, glui32 tag);
 static stream_t *libstate_stream_find_by_updatetag(glkunix_library_state_t state, glui32 tag);
 
@@ -37,6 +45,11 @@ static stream_t *libstate_stream_find_by_updatetag(glkunix_library_state_t state
  */
 glui32 glkunix_update_from_library_state(glkunix_library_state_t state)
 {
+    unsigned long long tracestart = 0;
+
+    if (gli_tracing)
+        tracestart = gli_trace_now();
+
     /* First close all the windows and streams and filerefs. (It only really matters for streams, which need to be flushed, but it's cleaner to close everything.) */
     if (gli_rootwin) {
         /* This takes care of all the windows. */
@@ -73,6 +86,18 @@ glui32 glkunix_update_from_library_state(glkunix_library_state_t state)
     gli_windows_update_from_state(state->windowlist, state->windowcount, state->rootwin, state->generation);
     gli_streams_update_from_state(state->streamlist, state->streamcount, state->currentstr);
     gli_filerefs_update_from_state(state->filereflist, state->filerefcount);
+
+    /* The windows are in place, so the subscription can refer to them.
+       This takes ownership of the subscription object. */
+    if (state->subscription) {
+        gli_windows_subscribe(state->subscription);
+        state->subscription = NULL;
+    }
+    else {
+        data_subscription_t *allsub = data_subscription_alloc();
+        allsub->all = TRUE;
+        gli_windows_subscribe(allsub);
+    }
     
     glk_request_timer_events(state->timerinterval);
     gli_set_last_event_type(0xFFFFFFFE);
@@ -93,16 +118,35 @@ glui32 glkunix_update_from_library_state(glkunix_library_state_t state)
     state->rootwin = NULL;
     state->currentstr = NULL;
     
+    if (gli_tracing)
+        gli_trace_span("update_from_state", "autosave", tracestart);
     return TRUE;
 }
 
 void glkunix_save_library_state(strid_t file, strid_t omitstream, glkunix_serialize_object_f extra_state_func, void *extra_state_rock)
+{
+    glkunix_save_library_state_limit(file, omitstream, extra_state_func, extra_state_rock, pref_autosaveparas, pref_autosavechars);
+}
+
+/* Same as glkunix_save_library_state(), but each buffer window saves at
+   most maxparas paragraphs and maxchars characters of its text. (Zero
+   means no limit.) Older text is dropped from the autosave; the live
+   window is not affected. */
+void glkunix_save_library_state_limit(strid_t file, strid_t omitstream, glkunix_serialize_object_f extra_state_func, void *extra_state_rock, long maxparas, long maxchars)
 {
     FILE *fl = file->file;
     winid_t tmpwin;
     strid_t tmpstr;
     frefid_t tmpfref;
     int first;
+    unsigned long long tracestart = 0;
+
+    if (gli_tracing)
+        tracestart = gli_trace_now();
+
+    /* Get buffered file output onto disk, so that the file positions
+       we record are meaningful if we're restored in another process. */
+    gli_streams_flush_all();
     
     fprintf(fl, "{\"type\":\"autosave\", \"version\":%d", SERIAL_VERSION);
 
@@ -116,6 +160,9 @@ void glkunix_save_library_state(strid_t file, strid_t omitstream, glkunix_serial
     fprintf(fl, ",\n\"supportcaps\":");
     data_supportcaps_print(fl, &gli_supportcaps);
 
+    fprintf(fl, ",\n\"subscription\":");
+    data_subscription_print(fl, gli_windows_get_subscription());
+
     /* We don't use data_window_print (etc) here because we need a complete state dump for the autosave. It's way beyond the documented RemGlk/GlkOte JSON API. */
     
     fprintf(fl, ",\n\"windows\": [\n");
@@ -123,7 +170,7 @@ void glkunix_save_library_state(strid_t file, strid_t omitstream, glkunix_serial
     for (tmpwin = glk_window_iterate(NULL, NULL); tmpwin; tmpwin = glk_window_iterate(tmpwin, NULL)) {
         if (!first) fprintf(fl, ",\n");
         first = FALSE;
-        window_state_print(fl, tmpwin);
+        window_state_print(fl, tmpwin, maxparas, maxchars);
     }
     fprintf(fl, "]");
     
@@ -165,9 +212,12 @@ void glkunix_save_library_state(strid_t file, strid_t omitstream, glkunix_serial
     }
     
     fprintf(fl, "}\n");
+
+    if (gli_tracing)
+        gli_trace_span("autosave", "autosave", tracestart);
 }
 
-static void window_state_print(FILE *fl, winid_t win)
+static void window_state_print(FILE *fl, winid_t win, long maxparas, long maxchars)
 {
     int first;
     int ix;
@@ -239,27 +289,16 @@ static void window_state_print(FILE *fl, winid_t win)
         fprintf(fl, ",\n\"buf_width\":%d, \"buf_height\":%d", dwin->width, dwin->height);
         
         /* We don't save the updatemark/startclear. */
-        
-        fprintf(fl, ",\n\"buf_runs\":[\n");
-        first = TRUE;
-        for (ix=0; ix<dwin->numruns; ix++) {
-            if (!first) fprintf(fl, ",\n");
-            first = FALSE;
-            tbrun_print(fl, &dwin->runs[ix]);
-        }
-        fprintf(fl, "]");
 
-        fprintf(fl, ",\n\"buf_specials\":[\n");
-        first = TRUE;
-        for (ix=0; ix<dwin->numspecials; ix++) {
-            if (!first) fprintf(fl, ",\n");
-            first = FALSE;
-            data_specialspan_auto_print(fl, dwin->specials[ix]);
+        if (dwin->deferred && maxparas <= 0 && maxchars <= 0) {
+            /* Nothing has touched the text since autorestore, so the
+               saved fields can go back out without being decoded. */
+            glkunix_serialize_detached_fields(fl, dwin->deferred);
+        }
+        else {
+            win_textbuffer_ensure_loaded(dwin);
+            textbuffer_contents_print(fl, dwin, maxparas, maxchars);
         }
-        fprintf(fl, "]");
-
-        fprintf(fl, ",\n\"buf_chars\":\n");
-        print_ustring_len_json(dwin->chars, dwin->numchars, fl);
 
         /* Fields only relevant during line input. */
         if (dwin->inbuf && dwin->inmax && gli_dispatch_locate_arr) {
@@ -400,14 +439,114 @@ static void window_state_print(FILE *fl, winid_t win)
     fprintf(fl, "}\n");
 }
 
-static void tbrun_print(FILE *fl, tbrun_t *run)
+/* Print the chars, runs, and specials of a buffer window. */
+static void textbuffer_contents_print(FILE *fl, window_textbuffer_t *dwin, long maxparas, long maxchars)
 {
+    int ix;
+    int first;
+
+    /* If the text is limited, we skip everything before cnum. The
+       runs and specials that survive are renumbered to match, just
+       as in win_textbuffer_trim_buffer(). */
+    long cnum = textbuffer_save_start(dwin, maxparas, maxchars);
+    long snum = 0;
+    long specnum = 0;
+    if (cnum > 0) {
+        for (snum=0; snum+1<dwin->numruns; snum++) {
+            if (dwin->runs[snum+1].pos > cnum)
+                break;
+        }
+        specnum = dwin->numspecials;
+        for (ix=snum; ix<dwin->numruns; ix++) {
+            if (dwin->runs[ix].specialnum >= 0) {
+                specnum = dwin->runs[ix].specialnum;
+                break;
+            }
+        }
+    }
+    
+    fprintf(fl, ",\n\"buf_runs\":[\n");
+    first = TRUE;
+    for (ix=snum; ix<dwin->numruns; ix++) {
+        if (!first) fprintf(fl, ",\n");
+        first = FALSE;
+        tbrun_print(fl, &dwin->runs[ix], cnum, specnum);
+    }
+    fprintf(fl, "]");
+
+    fprintf(fl, ",\n\"buf_specials\":[\n");
+    first = TRUE;
+    for (ix=specnum; ix<dwin->numspecials; ix++) {
+        if (!first) fprintf(fl, ",\n");
+        first = FALSE;
+        data_specialspan_auto_print(fl, dwin->specials[ix]);
+    }
+    fprintf(fl, "]");
+
+    fprintf(fl, ",\n\"buf_chars\":\n");
+    print_ustring_len_json(dwin->chars+cnum, dwin->numchars-cnum, fl);
+}
+
+/* Work out where the saved text of a buffer window should begin, given
+   the paragraph and character limits. We cut at a paragraph boundary
+   if we can; a single paragraph longer than maxchars gets cut in the
+   middle. */
+static long textbuffer_save_start(window_textbuffer_t *dwin, long maxparas, long maxchars)
+{
+    long cnum = 0;
+    long lx;
+
+    if (maxparas > 0) {
+        long count = 0;
+        /* A newline at the very end closes the last paragraph; it
+           doesn't start a new one, so we don't count it. */
+        for (lx=dwin->numchars-1; lx > 0; lx--) {
+            if (dwin->chars[lx-1] == '\n') {
+                count++;
+                if (count >= maxparas) {
+                    cnum = lx;
+                    break;
+                }
+            }
+        }
+    }
+
+    if (maxchars > 0 && dwin->numchars - cnum > maxchars) {
+        long limit = dwin->numchars - maxchars;
+        /* Move forward to the next paragraph start. */
+        for (lx=limit; lx < dwin->numchars; lx++) {
+            if (dwin->chars[lx-1] == '\n')
+                break;
+        }
+        if (lx >= dwin->numchars)
+            lx = limit;
+        cnum = lx;
+    }
+
+    return cnum;
+}
+
+/* Print a run, adjusted for the first cnum characters and specnum
+   specials being left out. */
+static void tbrun_print(FILE *fl, tbrun_t *run, long cnum, long specnum)
+{
+    long pos = run->pos - cnum;
+    long specialnum = run->specialnum;
+    if (pos < 0)
+        pos = 0;
+    if (specialnum >= 0) {
+        if (specialnum >= specnum)
+            specialnum -= specnum;
+        else
+            specialnum = -1;
+    }
+    
     fprintf(fl, "{\"style\":%d", run->style);
     if (run->hyperlink)
         fprintf(fl, ", \"hyperlink\":%ld", (long)run->hyperlink);
-    fprintf(fl, ", \"pos\":%ld", run->pos);
-    if (run->specialnum != -1)
-        fprintf(fl, ", \"specialnum\":%ld", run->specialnum);
+    fprintf(fl, ", \"pos\":%ld", pos);
+    if (specialnum != -1)
+        fprintf(fl, ", \"specialnum\":%ld", specialnum);
     fprintf(fl, "}\n");
 }
 
@@ -583,13 +722,28 @@ static void fileref_state_print(FILE *fl, frefid_t fref)
 
 /* We don't load the library state into our live library. Rather, it goes into a glkunix_library_state_t object, which can be brought live later. 
 */
+static glkunix_library_state_t load_library_state(strid_t file, glkunix_unserialize_object_f extra_state_func, void *extra_state_rock);
+
 glkunix_library_state_t glkunix_load_library_state(strid_t file, glkunix_unserialize_object_f extra_state_func, void *extra_state_rock)
+{
+    glkunix_library_state_t state;
+    unsigned long long tracestart = 0;
+
+    if (gli_tracing)
+        tracestart = gli_trace_now();
+    state = load_library_state(file, extra_state_func, extra_state_rock);
+    if (gli_tracing)
+        gli_trace_span("autorestore", "autosave", tracestart);
+    return state;
+}
+
+static glkunix_library_state_t load_library_state(strid_t file, glkunix_unserialize_object_f extra_state_func, void *extra_state_rock)
 {
     FILE *fl = file->file;
     int ix;
     
     struct glkunix_unserialize_context_struct ctx;
-    if (!glkunix_unserialize_object_root(fl, &ctx))
+    if (!glkunix_unserialize_object_root(fl, &ctx, textbuffer_deferkeys))
         return NULL;
 
     glui32 version;
@@ -618,6 +772,11 @@ glkunix_library_state_t glkunix_load_library_state(strid_t file, glkunix_unseria
     if (glkunix_unserialize_list(&ctx, "supportcaps", &dat, &count)) {
         state->supportcaps = data_supportcaps_parse(dat->dat);
     }
+    /* A null subscription (or none, in an older autosave) means all
+       windows. */
+    if (glkunix_unserialize_list(&ctx, "subscription", &dat, &count)) {
+        state->subscription = data_subscription_parse(dat->dat);
+    }
 
     /* First we create blank Glk object structures, filling in only the updatetags. (We have to do this before dealing with the object data, because objects can refer to each other.) */
     
@@ -799,58 +958,11 @@ static int window_state_parse(glkunix_library_state_t state, glkunix_unserialize
         glkunix_unserialize_int(entry, "buf_width", &dwin->width);
         glkunix_unserialize_int(entry, "buf_height", &dwin->height);
 
-        glui32 *buf;
-        long bufcount;
-        if (glkunix_unserialize_len_unicode(entry, "buf_chars", &buf, &bufcount)) {
-            if (bufcount > dwin->charssize) {
-                dwin->charssize = bufcount;
-                dwin->chars = (glui32 *)realloc(dwin->chars, dwin->charssize * sizeof(glui32));
-            }
-            for (ix=0; ix<bufcount; ix++)
-                dwin->chars[ix] = buf[ix];
-            dwin->numchars = bufcount;
-            free(buf);
-        }
-        
-        if (glkunix_unserialize_list(entry, "buf_runs", &array, &count)) {
-            if (count > dwin->runssize) {
-                dwin->runssize = (count | 7) + 1 + 8;
-                dwin->runs = (tbrun_t *)realloc(dwin->runs, dwin->runssize * sizeof(tbrun_t));
-            }
-            if (!dwin->runs)
-                return FALSE;
-            memset(dwin->runs, 0, dwin->runssize * sizeof(tbrun_t));
-            dwin->numruns = count;
-            for (ix=0; ix<count; ix++) {
-                tbrun_t *run = &dwin->runs[ix];
-                if (!glkunix_unserialize_list_entry(array, ix, &el))
-                    return FALSE;
-                glkunix_unserialize_int(el, "style", &intval);
-                run->style = intval;
-                glkunix_unserialize_uint32(el, "hyperlink", &run->hyperlink);
-                glkunix_unserialize_long(el, "pos", &run->pos);
-                if (!glkunix_unserialize_long(el, "specialnum", &run->specialnum)) {
-                    run->specialnum = -1; /* default value */
-                }
-            }
-        }
-
-        if (glkunix_unserialize_list(entry, "buf_specials", &array, &count)) {
-            if (count > dwin->specialssize) {
-                dwin->specialssize = (count | 7) + 1 + 8;
-                dwin->specials = (data_specialspan_t **)realloc(dwin->specials, dwin->specialssize * sizeof(data_specialspan_t *));
-            }
-            if (!dwin->specials)
-                return FALSE;
-            dwin->numspecials = count;
-            for (ix=0; ix<count; ix++) {
-                if (!glkunix_unserialize_list_entry(array, ix, &el))
-                    return FALSE;
-                dwin->specials[ix] = data_specialspan_auto_parse(el->dat);
-                if (!dwin->specials[ix])
-                    return FALSE;
-            }
-        }
+        /* The text itself was read as undecoded JSON, and stays that
+           way until somebody needs it. We pull it out of the entry now,
+           so that it survives when the rest of the autorestore data is
+           freed. */
+        dwin->deferred = glkunix_unserialize_detach_fields(entry, textbuffer_deferkeys);
 
         intval = FALSE;
         if (glkunix_unserialize_int(entry, "buf_ininput", &intval) && intval) {
@@ -873,7 +985,7 @@ static int window_state_parse(glkunix_library_state_t state, glkunix_unserialize
             }
         }
 
-        /* Clear dirty flags. */
+        /* Dirty flags are cleared when the deferred data is loaded. */
         dwin->updatemark = dwin->numchars;
         dwin->startclear = FALSE;
 
@@ -998,6 +1110,111 @@ static int window_state_parse(glkunix_library_state_t state, glkunix_unserialize
     return TRUE;
 }
 
+/* Decode the chars, runs, and specials of a buffer window. This is used
+   on the deferred data (see window_state_parse), so we can take over
+   the decoded strings rather than copying them. */
+static int textbuffer_contents_parse(window_textbuffer_t *dwin, glkunix_unserialize_context_t entry)
+{
+    int ix;
+    int intval;
+    glkunix_unserialize_context_t array;
+    glkunix_unserialize_context_t el;
+    int count;
+
+    glui32 *buf;
+    long bufcount;
+    if (glkunix_unserialize_take_len_unicode(entry, "buf_chars", &buf, &bufcount)) {
+        if (bufcount > dwin->charssize) {
+            free(dwin->chars);
+            dwin->chars = buf;
+            dwin->charssize = bufcount;
+        }
+        else {
+            memcpy(dwin->chars, buf, bufcount * sizeof(glui32));
+            free(buf);
+        }
+        dwin->numchars = bufcount;
+    }
+    
+    if (glkunix_unserialize_list(entry, "buf_runs", &array, &count)) {
+        if (count > dwin->runssize) {
+            dwin->runssize = (count | 7) + 1 + 8;
+            dwin->runs = (tbrun_t *)realloc(dwin->runs, dwin->runssize * sizeof(tbrun_t));
+        }
+        if (!dwin->runs)
+            return FALSE;
+        memset(dwin->runs, 0, dwin->runssize * sizeof(tbrun_t));
+        dwin->numruns = count;
+        for (ix=0; ix<count; ix++) {
+            tbrun_t *run = &dwin->runs[ix];
+            if (!glkunix_unserialize_list_entry(array, ix, &el))
+                return FALSE;
+            glkunix_unserialize_int(el, "style", &intval);
+            run->style = intval;
+            glkunix_unserialize_uint32(el, "hyperlink", &run->hyperlink);
+            glkunix_unserialize_long(el, "pos", &run->pos);
+            if (!glkunix_unserialize_long(el, "specialnum", &run->specialnum)) {
+                run->specialnum = -1; /* default value */
+            }
+        }
+    }
+
+    if (glkunix_unserialize_list(entry, "buf_specials", &array, &count)) {
+        if (count > dwin->specialssize) {
+            dwin->specialssize = (count | 7) + 1 + 8;
+            dwin->specials = (data_specialspan_t **)realloc(dwin->specials, dwin->specialssize * sizeof(data_specialspan_t *));
+        }
+        if (!dwin->specials)
+            return FALSE;
+        dwin->numspecials = count;
+        for (ix=0; ix<count; ix++) {
+            if (!glkunix_unserialize_list_entry(array, ix, &el))
+                return FALSE;
+            dwin->specials[ix] = data_specialspan_auto_parse(el->dat);
+            if (!dwin->specials[ix])
+                return FALSE;
+        }
+    }
+
+    return TRUE;
+}
+
+void win_textbuffer_load_deferred(window_textbuffer_t *dwin)
+{
+    struct glkunix_unserialize_context_struct ctx;
+
+    if (!dwin->deferred)
+        return;
+
+    ctx.dat = dwin->deferred;
+    ctx.subctx = NULL;
+    dwin->deferred = NULL;
+
+    glkunix_unserialize_decode_raw_fields(&ctx);
+    if (!textbuffer_contents_parse(dwin, &ctx))
+        gli_fatal_error("Autorestore buffer window contents invalid");
+
+    glkunix_unserialize_object_root_finalize(&ctx);
+
+    /* Clear dirty flags. */
+    dwin->updatemark = dwin->numchars;
+    dwin->startclear = FALSE;
+}
+
+void win_textbuffer_discard_deferred(window_textbuffer_t *dwin)
+{
+    struct glkunix_unserialize_context_struct ctx;
+
+    if (!dwin->deferred)
+        return;
+
+    ctx.dat = dwin->deferred;
+    ctx.subctx = NULL;
+    dwin->deferred = NULL;
+
+    glkunix_unserialize_object_root_finalize(&ctx);
+}
+
 static int stream_state_parse(glkunix_library_state_t state, glkunix_unserialize_context_t entry, strid_t str)
 {
     glui32 tag;
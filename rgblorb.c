@@ -1,4 +1,10 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/stat.h>
 #include "glk.h"
+#include "remglk.h"
 #include "gi_blorb.h"
 
 /* We'd like to be able to deal with game files in Blorb files, even
@@ -7,16 +13,167 @@
 
 static giblorb_map_t *blorbmap = 0; /* NULL */
 
+/* With the -mmap option, the whole Blorb file is mapped here, and chunk
+   loads point into it rather than reading private copies. */
+static void *blorbmapped = 0; /* NULL */
+static glui32 blorbmappedlen = 0;
+
+/* With the -blorbcache option, the parsed map (chunk table, resource
+   index, image sizes) is kept in a file in that directory, named for
+   the Blorb file's device, inode, modification time (to the
+   nanosecond, where the filesystem records it), and size. Another
+   process opening the same Blorb builds its map from the cache file
+   rather than reading the Blorb. If the Blorb changes, the name
+   changes, so a stale cache is never used; it's just left behind.
+   Cache files are written under a temporary name and renamed into
+   place, so a reader never sees a partial one. */
+
+#define CACHE_MAGIC (0x52476263) /* 'RGbc' */
+#define CACHE_VERSION (2)
+
+typedef struct blorbcache_header_struct {
+  glui32 magic;
+  glui32 version;
+  unsigned long long dev, ino, mtime, mtimensec, size;
+} blorbcache_header_t;
+
+static int blorbcache_path(strid_t file, blorbcache_header_t *header,
+  char *buf, int buflen)
+{
+  struct stat st;
+  int res;
+
+  if (!pref_blorbcachedir || file->type != strtype_File || !file->file)
+    return FALSE;
+  if (fstat(fileno(file->file), &st) != 0 || !S_ISREG(st.st_mode))
+    return FALSE;
+  /* Blorb positions are 32 bits, so a larger file can't be indexed. */
+  if ((unsigned long long)st.st_size > 0xFFFFFFFF)
+    return FALSE;
+
+  memset(header, 0, sizeof(blorbcache_header_t));
+  header->magic = CACHE_MAGIC;
+  header->version = CACHE_VERSION;
+  header->dev = st.st_dev;
+  header->ino = st.st_ino;
+  header->mtime = st.st_mtime;
+#ifdef __APPLE__
+  header->mtimensec = st.st_mtimespec.tv_nsec;
+#else
+  header->mtimensec = st.st_mtim.tv_nsec;
+#endif
+  header->size = st.st_size;
+
+  res = snprintf(buf, buflen, "%s/blorb-%llx-%llx-%llx.%09llu-%llx.idx",
+    pref_blorbcachedir, header->dev, header->ino, header->mtime,
+    header->mtimensec, header->size);
+  return (res > 0 && res < buflen);
+}
+
+static giblorb_err_t blorbcache_load(strid_t file, 
+  blorbcache_header_t *header, char *pathname)
+{
+  giblorb_err_t err = giblorb_err_NotFound;
+  FILE *fl;
+  unsigned char *ptr;
+  glui32 len;
+
+  fl = fopen(pathname, "rb");
+  if (!fl)
+    return giblorb_err_NotFound;
+
+  ptr = gli_map_file(fl, &len);
+  fclose(fl);
+  if (!ptr)
+    return giblorb_err_NotFound;
+
+  if (len > sizeof(blorbcache_header_t)
+    && !memcmp(ptr, header, sizeof(blorbcache_header_t))) {
+    err = giblorb_create_map_from_index(file,
+      ptr + sizeof(blorbcache_header_t),
+      len - sizeof(blorbcache_header_t), (glui32)header->size, &blorbmap);
+    if (err)
+      blorbmap = 0; /* NULL */
+  }
+
+  gli_unmap_file(ptr, len);
+  return err;
+}
+
+static void blorbcache_save(blorbcache_header_t *header, char *pathname)
+{
+  char tmppath[1024];
+  void *buf;
+  glui32 len;
+  FILE *fl;
+  int fd, res, ok;
+
+  /* The temporary file gets an unguessable name, created fresh by
+     mkstemp(), so a symlink planted in a shared cache directory can't
+     redirect the write. */
+  res = snprintf(tmppath, sizeof(tmppath), "%s.XXXXXX", pathname);
+  if (res <= 0 || res >= sizeof(tmppath))
+    return;
+
+  if (giblorb_export_index(blorbmap, &buf, &len))
+    return;
+
+  fd = mkstemp(tmppath);
+  if (fd < 0) {
+    free(buf);
+    return;
+  }
+  /* Other processes (and users) sharing the directory need to read it. */
+  fchmod(fd, 0644);
+  fl = fdopen(fd, "wb");
+  if (!fl) {
+    close(fd);
+    remove(tmppath);
+    free(buf);
+    return;
+  }
+  ok = (fwrite(header, sizeof(blorbcache_header_t), 1, fl) == 1);
+  if (ok)
+    ok = (fwrite(buf, 1, len, fl) == len);
+  if (fclose(fl) != 0)
+    ok = FALSE;
+  free(buf);
+
+  if (!ok || rename(tmppath, pathname) != 0)
+    remove(tmppath);
+}
+
 giblorb_err_t giblorb_set_resource_map(strid_t file)
 {
   giblorb_err_t err;
+  blorbcache_header_t header;
+  char cachepath[1024];
+  int usecache;
+  unsigned long long tracestart = 0;
+
+  if (gli_tracing)
+    tracestart = gli_trace_now();
+
+  usecache = blorbcache_path(file, &header, cachepath, sizeof(cachepath));
   
-  err = giblorb_create_map(file, &blorbmap);
-  if (err) {
-    blorbmap = 0; /* NULL */
-    return err;
+  if (!usecache || blorbcache_load(file, &header, cachepath) != giblorb_err_None) {
+    err = giblorb_create_map(file, &blorbmap);
+    if (err) {
+      blorbmap = 0; /* NULL */
+      return err;
+    }
+    if (usecache)
+      blorbcache_save(&header, cachepath);
+  }
+
+  if (pref_mmapresources && file->type == strtype_File) {
+    blorbmapped = gli_map_file(file->file, &blorbmappedlen);
+    if (blorbmapped)
+      giblorb_set_file_memory(blorbmap, blorbmapped, blorbmappedlen);
   }
   
+  if (gli_tracing)
+    gli_trace_span("map", "blorb", tracestart);
   return giblorb_err_None;
 }
 
@@ -30,6 +187,12 @@ giblorb_err_t giblorb_unset_resource_map()
     }
     blorbmap = 0; /* NULL */
   }
+
+  if (blorbmapped) {
+    gli_unmap_file(blorbmapped, blorbmappedlen);
+    blorbmapped = 0; /* NULL */
+    blorbmappedlen = 0;
+  }
   
   return giblorb_err_None;
 }
@@ -9,6 +9,9 @@
 #include <string.h>
 #include <ctype.h>
 #include <math.h>
+#include <errno.h>
+#include <poll.h>
+#include <unistd.h>
 
 #include "glk.h"
 #include "remglk.h"
@@ -26,6 +29,7 @@ typedef enum RawType_enum {
     rawtyp_True = 5,
     rawtyp_False = 6,
     rawtyp_Null = 7,
+    rawtyp_Raw = 8,
 } RawType;
 
 typedef struct strint_struct {
@@ -33,6 +37,62 @@ typedef struct strint_struct {
     glui32 val;
 } strint_t;
 
+/* Bytes read from the input, bytes written to stdout, and data
+   structures allocated, so far. These are only looked at for the
+   -turnstats statistics. */
+glui32 data_bytes_read = 0;
+glui32 data_bytes_written = 0;
+glui32 data_alloc_count = 0;
+
+/* Input from stdin doesn't go through stdio. We read() it into our own
+   buffer, so that data_event_poll() can check whether a complete event
+   has arrived without blocking. Other files (the -fastforward file,
+   autosave files) are read with getc() as usual. */
+static char *inbuf = NULL;
+static int inbuf_size = 0;
+static int inbuf_pos = 0; /* the next character to parse */
+static int inbuf_len = 0; /* characters in the buffer */
+static int inbuf_eof = FALSE;
+
+static int input_fill(int block);
+static int input_getc(void);
+static void input_ungetc(int ch);
+
+/* Text kept by data_raw_skimread() is parsed later straight from
+   memory; the parser is handed a NULL file for that. (Going through
+   fmemopen() would be several times slower.) */
+static char *rawtext_buf = NULL;
+static int rawtext_pos = 0;
+static int rawtext_len = 0;
+
+static int rawtext_getc(void);
+static void rawtext_ungetc(int ch);
+
+#define DATA_GETC(fl) (data_bytes_read++, ((fl) == stdin) ? input_getc() : (!(fl)) ? rawtext_getc() : getc(fl))
+#define DATA_UNGETC(ch, fl) (data_bytes_read--, ((fl) == stdin) ? input_ungetc(ch) : (!(fl)) ? rawtext_ungetc(ch) : (void)ungetc((ch), (fl)))
+
+/* Output goes through these, so that what reaches stdout is counted.
+   (The same print functions also write autosave files; those bytes
+   aren't counted.) */
+static void count_output(FILE *fl, int count)
+{
+    if (fl == stdout && count > 0)
+        data_bytes_written += count;
+}
+
+#define DATA_PRINTF(...) count_output(stdout, printf(__VA_ARGS__))
+#define DATA_FPRINTF(fl, ...) count_output((fl), fprintf((fl), __VA_ARGS__))
+
+/* With -fastforward, input is read from this file until it runs out,
+   and only then from stdin. */
+static FILE *fastforwardfile = NULL;
+int gli_fastforwarding = FALSE;
+
+/* Events which arrived together in one list, and have not yet been
+   handed to glk_select(). The ones before eventqueuepos are used up. */
+static gen_list_t eventqueue;
+static int eventqueuepos = 0;
+
 static strint_t special_char_table[] = {
     { "left", keycode_Left },
     { "right", keycode_Right },
@@ -63,7 +123,9 @@ static strint_t special_char_table[] = {
 
 /* data_raw_t: Encodes a JSON data object. For lists and structs,
    this contains further JSON structures recursively. All text data
-   is Unicode, stored as glui32 arrays. */
+   is Unicode, stored as glui32 arrays.
+   A rawtyp_Raw object is a value which was not parsed at all; rawtext
+   holds its JSON text (count bytes, not terminated). */
 struct data_raw_struct {
     RawType type;
 
@@ -75,13 +137,17 @@ struct data_raw_struct {
     glsi32 number;
     double realnumber;
     glui32 *str;
+    char *rawtext;
     data_raw_t **list;
     int count;
     int allocsize;
 };
 
-static data_raw_t *data_raw_blockread(FILE *file);
-static data_raw_t *data_raw_blockread_sub(FILE *file, char *termchar);
+static data_raw_t *data_raw_blockread(FILE *file, char **rawkeys);
+static data_event_t *data_event_parse(data_raw_t *rawdata);
+static void data_event_enqueue(data_raw_t *rawdata);
+static data_raw_t *data_raw_blockread_sub(FILE *file, char *termchar, char **rawkeys);
+static data_raw_t *data_raw_skimread(FILE *file);
 
 /* While parsing JSON, we need a place to stash strings as they come in.
    Here are a couple of resizable character buffers. */
@@ -101,6 +167,157 @@ void gli_initialize_datainput()
     ustringbuf = malloc(ustringbuf_size * sizeof(glui32));
     if (!ustringbuf)
         gli_fatal_error("data: Unable to allocate memory for string buffer");
+
+    inbuf_size = 1024;
+    inbuf = malloc(inbuf_size * sizeof(char));
+    if (!inbuf)
+        gli_fatal_error("data: Unable to allocate memory for input buffer");
+    inbuf_pos = 0;
+    inbuf_len = 0;
+    inbuf_eof = FALSE;
+
+    gen_list_init(&eventqueue);
+    eventqueuepos = 0;
+}
+
+/* Read more of stdin into the input buffer. If block is false, this
+   only reads what is already available. Returns whether anything was
+   read. */
+static int input_fill(int block)
+{
+    struct pollfd pfd;
+    ssize_t count;
+
+    if (inbuf_eof)
+        return FALSE;
+
+    if (inbuf_pos > 0) {
+        if (inbuf_pos < inbuf_len)
+            memmove(inbuf, inbuf+inbuf_pos, inbuf_len-inbuf_pos);
+        inbuf_len -= inbuf_pos;
+        inbuf_pos = 0;
+    }
+    if (inbuf_len >= inbuf_size) {
+        inbuf_size *= 2;
+        inbuf = realloc(inbuf, inbuf_size * sizeof(char));
+        if (!inbuf)
+            gli_fatal_error("data: Unable to allocate memory for input buffer");
+    }
+
+    if (!block) {
+        pfd.fd = fileno(stdin);
+        pfd.events = POLLIN;
+        pfd.revents = 0;
+        if (poll(&pfd, 1, 0) <= 0)
+            return FALSE;
+    }
+
+    do {
+        count = read(fileno(stdin), inbuf+inbuf_len, inbuf_size-inbuf_len);
+    } while (count < 0 && errno == EINTR);
+
+    if (count <= 0) {
+        inbuf_eof = TRUE;
+        return FALSE;
+    }
+    inbuf_len += count;
+    return TRUE;
+}
+
+static int input_getc()
+{
+    if (inbuf_pos >= inbuf_len) {
+        if (!input_fill(TRUE))
+            return EOF;
+    }
+    return (unsigned char)inbuf[inbuf_pos++];
+}
+
+/* Only the last character read can be pushed back. */
+static void input_ungetc(int ch)
+{
+    if (ch != EOF && inbuf_pos > 0)
+        inbuf_pos--;
+}
+
+static int rawtext_getc()
+{
+    if (rawtext_pos >= rawtext_len)
+        return EOF;
+    return (unsigned char)rawtext_buf[rawtext_pos++];
+}
+
+static void rawtext_ungetc(int ch)
+{
+    if (ch != EOF && rawtext_pos > 0)
+        rawtext_pos--;
+}
+
+/* Check whether the input buffer contains a complete JSON object (or
+   list), by counting brackets. We don't need to validate anything here;
+   the parser does that. */
+static int input_object_ready()
+{
+    int ix;
+    int depth = 0;
+    int instring = FALSE;
+
+    for (ix=inbuf_pos; ix<inbuf_len; ix++) {
+        char ch = inbuf[ix];
+        if (instring) {
+            if (ch == '\\')
+                ix++;
+            else if (ch == '"')
+                instring = FALSE;
+            continue;
+        }
+        if (ch == '"') {
+            instring = TRUE;
+        }
+        else if (ch == '{' || ch == '[') {
+            depth++;
+        }
+        else if (ch == '}' || ch == ']') {
+            depth--;
+            if (depth <= 0)
+                return TRUE;
+        }
+        else if (depth == 0 && !isspace(ch)) {
+            /* Not an object at all. Let the parser complain. */
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+
+/* Set up the queued input for -fastforward. This is called from main(),
+   before the init event is read (since the file may contain it). */
+void gli_initialize_fastforward(char *pathname)
+{
+    fastforwardfile = fopen(pathname, "r");
+    if (!fastforwardfile)
+        gli_fatal_error("data: Unable to open fast-forward file");
+    gli_fastforwarding = TRUE;
+}
+
+/* Is there more queued input in the -fastforward file? Once there isn't,
+   the file is closed and the next event will come from stdin. */
+int data_fastforward_pending()
+{
+    int ch;
+
+    if (!fastforwardfile)
+        return FALSE;
+
+    while (isspace(ch = getc(fastforwardfile))) { };
+    if (ch != EOF) {
+        ungetc(ch, fastforwardfile);
+        return TRUE;
+    }
+
+    fclose(fastforwardfile);
+    fastforwardfile = NULL;
+    return FALSE;
 }
 
 static int parse_hex_digit(char ch)
@@ -173,23 +390,23 @@ void print_ustring_len_json(glui32 *buf, glui32 len, FILE *fl)
 {
     int ix;
 
-    fprintf(fl, "\"");
+    DATA_FPRINTF(fl, "\"");
     for (ix=0; ix<len; ix++) {
         glui32 ch = buf[ix];
         if (ch == '\"')
-            fprintf(fl, "\\\"");
+            DATA_FPRINTF(fl, "\\\"");
         else if (ch == '\\')
-            fprintf(fl, "\\\\");
+            DATA_FPRINTF(fl, "\\\\");
         else if (ch == '\n')
-            fprintf(fl, "\\n");
+            DATA_FPRINTF(fl, "\\n");
         else if (ch == '\t')
-            fprintf(fl, "\\t");
+            DATA_FPRINTF(fl, "\\t");
         else if (ch < 32)
-            fprintf(fl, "\\u%04X", ch);
+            DATA_FPRINTF(fl, "\\u%04X", ch);
         else
-            gli_putchar_utf8(ch, fl);
+            count_output(fl, gli_putchar_utf8(ch, fl));
     }
-    fprintf(fl, "\"");
+    DATA_FPRINTF(fl, "\"");
 }
 
 /* Send a Latin-1 string to an output stream, validly JSON-encoded.
@@ -198,23 +415,23 @@ void print_string_json(char *buf, FILE *fl)
 {
     char *cx;
 
-    fprintf(fl, "\"");
+    DATA_FPRINTF(fl, "\"");
     for (cx=buf; *cx; cx++) {
         glui32 ch = (*cx) & 0xFF;
         if (ch == '\"')
-            fprintf(fl, "\\\"");
+            DATA_FPRINTF(fl, "\\\"");
         else if (ch == '\\')
-            fprintf(fl, "\\\\");
+            DATA_FPRINTF(fl, "\\\\");
         else if (ch == '\n')
-            fprintf(fl, "\\n");
+            DATA_FPRINTF(fl, "\\n");
         else if (ch == '\t')
-            fprintf(fl, "\\t");
+            DATA_FPRINTF(fl, "\\t");
         else if (ch < 32)
-            fprintf(fl, "\\u%04X", ch);
+            DATA_FPRINTF(fl, "\\u%04X", ch);
         else
-            gli_putchar_utf8(ch, fl);
+            count_output(fl, gli_putchar_utf8(ch, fl));
     }
-    fprintf(fl, "\"");
+    DATA_FPRINTF(fl, "\"");
 }
 
 /* Send a Latin-1 string to an output stream, validly JSON-encoded.
@@ -225,23 +442,23 @@ void print_string_len_json(char *buf, int len, FILE *fl)
     char *cx;
     int ix;
     
-    fprintf(fl, "\"");
+    DATA_FPRINTF(fl, "\"");
     for (ix=0, cx=buf; ix<len; ix++, cx++) {
         glui32 ch = (*cx) & 0xFF;
         if (ch == '\"')
-            fprintf(fl, "\\\"");
+            DATA_FPRINTF(fl, "\\\"");
         else if (ch == '\\')
-            fprintf(fl, "\\\\");
+            DATA_FPRINTF(fl, "\\\\");
         else if (ch == '\n')
-            fprintf(fl, "\\n");
+            DATA_FPRINTF(fl, "\\n");
         else if (ch == '\t')
-            fprintf(fl, "\\t");
+            DATA_FPRINTF(fl, "\\t");
         else if (ch < 32)
-            fprintf(fl, "\\u%04X", ch);
+            DATA_FPRINTF(fl, "\\u%04X", ch);
         else
-            gli_putchar_utf8(ch, fl);
+            count_output(fl, gli_putchar_utf8(ch, fl));
     }
-    fprintf(fl, "\"");
+    DATA_FPRINTF(fl, "\"");
 }
 
 /* Send a UTF-8 string to an output stream, validly JSON-encoded.
@@ -252,23 +469,23 @@ void print_utf8string_json(char *buf, FILE *fl)
 {
     char *cx;
 
-    fprintf(fl, "\"");
+    DATA_FPRINTF(fl, "\"");
     for (cx=buf; *cx; cx++) {
         glui32 ch = (*cx) & 0xFF;
         if (ch == '\"')
-            fprintf(fl, "\\\"");
+            DATA_FPRINTF(fl, "\\\"");
         else if (ch == '\\')
-            fprintf(fl, "\\\\");
+            DATA_FPRINTF(fl, "\\\\");
         else if (ch == '\n')
-            fprintf(fl, "\\n");
+            DATA_FPRINTF(fl, "\\n");
         else if (ch == '\t')
-            fprintf(fl, "\\t");
+            DATA_FPRINTF(fl, "\\t");
         else if (ch < 32)
-            fprintf(fl, "\\u%04X", ch);
+            DATA_FPRINTF(fl, "\\u%04X", ch);
         else
-            fputc(ch, fl);
+            count_output(fl, (fputc(ch, fl) == EOF) ? 0 : 1);
     }
-    fprintf(fl, "\"");
+    DATA_FPRINTF(fl, "\"");
 }
 
 void gen_list_init(gen_list_t *list)
@@ -293,11 +510,13 @@ void gen_list_append(gen_list_t *list, void *val)
     if (!list->list) {
         list->allocsize = 4;
         list->list = malloc(list->allocsize * sizeof(void *));
+        data_alloc_count++;
     }
     else {
         if (list->count >= list->allocsize) {
             list->allocsize *= 2;
             list->list = realloc(list->list, list->allocsize * sizeof(void *));
+            data_alloc_count++;
         }
     }
 
@@ -312,6 +531,7 @@ static data_raw_t *data_raw_alloc(RawType type)
     data_raw_t *dat = malloc(sizeof(data_raw_t));
     if (!dat)
         gli_fatal_error("data: Unable to allocate memory for data block");
+    data_alloc_count++;
 
     dat->type = type;
     dat->key = NULL;
@@ -319,6 +539,7 @@ static data_raw_t *data_raw_alloc(RawType type)
     dat->number = 0;
     dat->realnumber = 0.0;
     dat->str = NULL;
+    dat->rawtext = NULL;
     dat->list = NULL;
     dat->count = 0;
     dat->allocsize = 0;
@@ -329,6 +550,8 @@ static void data_raw_free(data_raw_t *dat)
 {
     if (dat->str)
         free(dat->str);
+    if (dat->rawtext)
+        free(dat->rawtext);
     if (dat->key)
         free(dat->key);
     if (dat->list) {
@@ -360,70 +583,90 @@ static void data_raw_ensure_size(data_raw_t *dat, int size)
         gli_fatal_error("data: Unable to allocate memory for data list");
 }
 
-void data_raw_print(data_raw_t *dat)
+static void data_raw_fprint(FILE *fl, data_raw_t *dat)
 {
     int ix;
 
     if (!dat) {
-        printf("null");
+        DATA_FPRINTF(fl, "null");
         return;
     }
 
     switch (dat->type) {
         case rawtyp_Number:
             /* We don't need to output floats. */
-            printf("%ld", (long)dat->number);
+            DATA_FPRINTF(fl, "%ld", (long)dat->number);
             return;
         case rawtyp_True:
-            printf("true");
+            DATA_FPRINTF(fl, "true");
             return;
         case rawtyp_False:
-            printf("false");
+            DATA_FPRINTF(fl, "false");
             return;
         case rawtyp_Null:
-            printf("null");
+            DATA_FPRINTF(fl, "null");
             return;
         case rawtyp_Str:
-            print_ustring_len_json(dat->str, dat->count, stdout);
+            print_ustring_len_json(dat->str, dat->count, fl);
             return;
         case rawtyp_List:
-            printf("[ ");
+            DATA_FPRINTF(fl, "[ ");
             for (ix=0; ix<dat->count; ix++) {
-                data_raw_print(dat->list[ix]);
+                data_raw_fprint(fl, dat->list[ix]);
                 if (ix != dat->count-1)
-                    printf(", ");
+                    DATA_FPRINTF(fl, ", ");
                 else
-                    printf(" ");
+                    DATA_FPRINTF(fl, " ");
             }
-            printf("]");
+            DATA_FPRINTF(fl, "]");
             return;
         case rawtyp_Struct:
-            printf("{ ");
+            DATA_FPRINTF(fl, "{ ");
             for (ix=0; ix<dat->count; ix++) {
                 data_raw_t *subdat = dat->list[ix];
-                print_ustring_len_json(subdat->key, subdat->keylen, stdout);
-                printf(": ");
-                data_raw_print(subdat);
+                print_ustring_len_json(subdat->key, subdat->keylen, fl);
+                DATA_FPRINTF(fl, ": ");
+                data_raw_fprint(fl, subdat);
                 if (ix != dat->count-1)
-                    printf(", ");
+                    DATA_FPRINTF(fl, ", ");
                 else
-                    printf(" ");
+                    DATA_FPRINTF(fl, " ");
             }
-            printf("}");
+            DATA_FPRINTF(fl, "}");
+            return;
+        case rawtyp_Raw:
+            count_output(fl, fwrite(dat->rawtext, 1, dat->count, fl));
             return;
         default:
-            printf("null");
+            DATA_FPRINTF(fl, "null");
             return;
     }
 }
 
+void data_raw_print(data_raw_t *dat)
+{
+    data_raw_fprint(stdout, dat);
+}
+
 /* Read one JSON data object from the file. If there is none, or if the
-   object is incomplete, this blocks and waits for an object to finish. */
-static data_raw_t *data_raw_blockread(FILE *file)
+   object is incomplete, this blocks and waits for an object to finish.
+   Struct fields whose keys appear in rawkeys (a NULL-terminated list,
+   or NULL for none) are not parsed; see data_raw_skimread(). */
+static data_raw_t *data_raw_blockread(FILE *file, char **rawkeys)
 {
     char termchar;
+    int ch;
 
-    data_raw_t *dat = data_raw_blockread_sub(file, &termchar);
+    if (gli_turnstats) {
+        /* Whatever time passes before the first character arrives is
+           waiting, not parsing. */
+        while (isspace(ch = DATA_GETC(file))) { };
+        if (ch != EOF)
+            DATA_UNGETC(ch, file);
+        gli_turnstats_switch(gli_phase_Wait, gli_phase_Parse);
+    }
+
+    data_raw_t *dat = data_raw_blockread_sub(file, &termchar, rawkeys);
     if (!dat)
         gli_fatal_error("data: Unexpected end of data object");
 
@@ -563,13 +806,13 @@ static data_raw_t *data_raw_struct_field(data_raw_t *dat, char *key)
 /* Internal method: read a JSON element from the file. If this sees
    a close-brace or close-bracket, it returns NULL and stores the
    character in *termchar. */
-static data_raw_t *data_raw_blockread_sub(FILE *file, char *termchar)
+static data_raw_t *data_raw_blockread_sub(FILE *file, char *termchar, char **rawkeys)
 {
     int ch;
 
     *termchar = '\0';
 
-    while (isspace(ch = getc(file))) { };
+    while (isspace(ch = DATA_GETC(file))) { };
     if (ch == EOF)
         gli_fatal_error("data: Unexpected end of input");
     
@@ -584,27 +827,27 @@ static data_raw_t *data_raw_blockread_sub(FILE *file, char *termchar)
         
         if (ch == '-') {
             minus = TRUE;
-            ch = getc(file);
+            ch = DATA_GETC(file);
         }
 
         /* We accept "01" here, which is technically outside the spec. */
         while (ch >= '0' && ch <= '9') {
             dat->number = 10 * dat->number + (ch-'0');
-            ch = getc(file);
+            ch = DATA_GETC(file);
         }
 
         if (ch == '.' || ch == 'e' || ch == 'E') {
             /* We have to think about real numbers. And scientific notation, for json's sake. */
             double fval = dat->number;
             if (ch == '.') {
-                ch = getc(file);
+                ch = DATA_GETC(file);
                 long numer = 0;
                 long numerlen = 0;
                 /* We accept "1." here, which is outside the spec. */
                 while (ch >= '0' && ch <= '9') {
                     numer = 10 * numer + (ch-'0');
                     numerlen++;
-                    ch = getc(file);
+                    ch = DATA_GETC(file);
                 }
                 if (numerlen) {
                     fval += numer * pow(10, -numerlen);
@@ -612,21 +855,21 @@ static data_raw_t *data_raw_blockread_sub(FILE *file, char *termchar)
             }
 
             if (ch == 'e' || ch == 'E') {
-                ch = getc(file);
+                ch = DATA_GETC(file);
                 int expminus = FALSE;
                 /* We accept "1e", "1e+", and "1-e" here. Again, non-spec. */
                 if (ch == '-') {
                     expminus = TRUE;
-                    ch = getc(file);
+                    ch = DATA_GETC(file);
                 }
                 else if (ch == '+') {
                     expminus = FALSE;
-                    ch = getc(file);
+                    ch = DATA_GETC(file);
                 }
                 int expnum = 0;
                 while (ch >= '0' && ch <= '9') {
                     expnum = 10 * expnum + (ch-'0');
-                    ch = getc(file);
+                    ch = DATA_GETC(file);
                 }
                 if (expminus) {
                     expnum = -expnum;
@@ -650,7 +893,7 @@ static data_raw_t *data_raw_blockread_sub(FILE *file, char *termchar)
         }
 
         if (ch != EOF)
-            ungetc(ch, file);
+            DATA_UNGETC(ch, file);
         return dat;
     }
 
@@ -660,7 +903,7 @@ static data_raw_t *data_raw_blockread_sub(FILE *file, char *termchar)
         int ix;
         int ucount = 0;
         int count = 0;
-        while ((ch = getc(file)) != '"') {
+        while ((ch = DATA_GETC(file)) != '"') {
             if (ch == EOF)
                 gli_fatal_error("data: Unterminated string");
             if (ch >= 0 && ch < 32)
@@ -669,18 +912,18 @@ static data_raw_t *data_raw_blockread_sub(FILE *file, char *termchar)
                 ensure_ustringbuf_size(ucount + 2*count + 1);
                 ucount += gli_parse_utf8((unsigned char *)stringbuf, count, ustringbuf+ucount, 2*count);
                 count = 0;
-                ch = getc(file);
+                ch = DATA_GETC(file);
                 if (ch == EOF)
                     gli_fatal_error("data: Unterminated backslash escape");
                 if (ch == 'u') {
                     glui32 val = 0;
-                    ch = getc(file);
+                    ch = DATA_GETC(file);
                     val = 16*val + parse_hex_digit(ch);
-                    ch = getc(file);
+                    ch = DATA_GETC(file);
                     val = 16*val + parse_hex_digit(ch);
-                    ch = getc(file);
+                    ch = DATA_GETC(file);
                     val = 16*val + parse_hex_digit(ch);
-                    ch = getc(file);
+                    ch = DATA_GETC(file);
                     val = 16*val + parse_hex_digit(ch);
                     ustringbuf[ucount++] = val;
                     continue;
@@ -740,7 +983,7 @@ static data_raw_t *data_raw_blockread_sub(FILE *file, char *termchar)
         while (isalnum(ch) || ch == '_') {
             ensure_stringbuf_size(count+1);
             stringbuf[count++] = ch;
-            ch = getc(file);
+            ch = DATA_GETC(file);
         }
 
         ensure_stringbuf_size(count+1);
@@ -756,7 +999,7 @@ static data_raw_t *data_raw_blockread_sub(FILE *file, char *termchar)
             gli_fatal_error("data: Unrecognized symbol");
 
         if (ch != EOF)
-            ungetc(ch, file);
+            DATA_UNGETC(ch, file);
         return dat;
     }
 
@@ -767,7 +1010,7 @@ static data_raw_t *data_raw_blockread_sub(FILE *file, char *termchar)
         char term = '\0';
 
         while (TRUE) {
-            data_raw_t *subdat = data_raw_blockread_sub(file, &term);
+            data_raw_t *subdat = data_raw_blockread_sub(file, &term, rawkeys);
             if (!subdat) {
                 if (term == ']') {
                     if (commapending)
@@ -780,7 +1023,7 @@ static data_raw_t *data_raw_blockread_sub(FILE *file, char *termchar)
             dat->list[count++] = subdat;
             commapending = FALSE;
 
-            while (isspace(ch = getc(file))) { };
+            while (isspace(ch = DATA_GETC(file))) { };
             if (ch == ']')
                 break;
             if (ch != ',')
@@ -799,7 +1042,7 @@ static data_raw_t *data_raw_blockread_sub(FILE *file, char *termchar)
         char term = '\0';
 
         while (TRUE) {
-            data_raw_t *keydat = data_raw_blockread_sub(file, &term);
+            data_raw_t *keydat = data_raw_blockread_sub(file, &term, rawkeys);
             if (!keydat) {
                 if (term == '}') {
                     if (commapending)
@@ -812,13 +1055,24 @@ static data_raw_t *data_raw_blockread_sub(FILE *file, char *termchar)
             if (keydat->type != rawtyp_Str)
                 gli_fatal_error("data: Struct key must be string");
 
-            while (isspace(ch = getc(file))) { };
+            while (isspace(ch = DATA_GETC(file))) { };
             
             if (ch != ':')
                 gli_fatal_error("data: Expected colon in struct");
 
-            data_raw_t *subdat = data_raw_blockread_sub(file, &term);
-            if (!keydat)
+            data_raw_t *subdat = NULL;
+            if (rawkeys) {
+                char **keyptr;
+                for (keyptr=rawkeys; *keyptr; keyptr++) {
+                    if (data_raw_string_is(keydat, *keyptr)) {
+                        subdat = data_raw_skimread(file);
+                        break;
+                    }
+                }
+            }
+            if (!subdat)
+                subdat = data_raw_blockread_sub(file, &term, rawkeys);
+            if (!subdat)
                 gli_fatal_error("data: Mismatched end of struct");
 
             subdat->key = keydat->str;
@@ -832,7 +1086,7 @@ static data_raw_t *data_raw_blockread_sub(FILE *file, char *termchar)
             dat->list[count++] = subdat;
             commapending = FALSE;
 
-            while (isspace(ch = getc(file))) { };
+            while (isspace(ch = DATA_GETC(file))) { };
             if (ch == '}')
                 break;
             if (ch != ',')
@@ -848,6 +1102,107 @@ static data_raw_t *data_raw_blockread_sub(FILE *file, char *termchar)
     return NULL;
 }
 
+/* Read one JSON value from the file, but only as text. We track string
+   quoting and bracket depth to find where the value ends, but nothing
+   is decoded or allocated except the text itself. The value can be
+   parsed later with data_raw_parse_rawtext(). */
+static data_raw_t *data_raw_skimread(FILE *file)
+{
+    data_raw_t *dat = data_raw_alloc(rawtyp_Raw);
+    char *buf;
+    int size = 256;
+    int count = 0;
+    int depth = 0;
+    int instring = FALSE;
+    int ch;
+
+    buf = malloc(size);
+    if (!buf)
+        gli_fatal_error("data: Unable to allocate memory for raw text");
+
+    while (isspace(ch = DATA_GETC(file))) { };
+
+    while (TRUE) {
+        if (ch == EOF)
+            gli_fatal_error("data: Unexpected end of input");
+
+        if (!instring && depth == 0 && count > 0
+            && (ch == ',' || ch == ']' || ch == '}' || isspace(ch))) {
+            /* The end of a bare number or symbol. */
+            DATA_UNGETC(ch, file);
+            break;
+        }
+
+        if (count+2 > size) {
+            size *= 2;
+            buf = realloc(buf, size);
+            if (!buf)
+                gli_fatal_error("data: Unable to allocate memory for raw text");
+        }
+        buf[count++] = ch;
+
+        if (instring) {
+            if (ch == '\\') {
+                ch = DATA_GETC(file);
+                if (ch == EOF)
+                    gli_fatal_error("data: Unterminated backslash escape");
+                buf[count++] = ch;
+            }
+            else if (ch == '"') {
+                instring = FALSE;
+                if (depth == 0)
+                    break;
+            }
+        }
+        else if (ch == '"') {
+            instring = TRUE;
+        }
+        else if (ch == '[' || ch == '{') {
+            depth++;
+        }
+        else if (ch == ']' || ch == '}') {
+            if (depth == 0)
+                gli_fatal_error("data: Mismatched end of value");
+            depth--;
+            if (depth == 0)
+                break;
+        }
+
+        ch = DATA_GETC(file);
+    }
+
+    /* Give back the unused part of the buffer. */
+    if (count < size) {
+        char *newbuf = realloc(buf, count);
+        if (newbuf)
+            buf = newbuf;
+    }
+    dat->rawtext = buf;
+    dat->count = count;
+    return dat;
+}
+
+/* Parse the text of a rawtyp_Raw object, returning a new object. */
+static data_raw_t *data_raw_parse_rawtext(data_raw_t *rawdat)
+{
+    data_raw_t *dat;
+    char termchar;
+    glui32 bytesread = data_bytes_read;
+
+    rawtext_buf = rawdat->rawtext;
+    rawtext_pos = 0;
+    rawtext_len = rawdat->count;
+    dat = data_raw_blockread_sub(NULL, &termchar, NULL);
+    rawtext_buf = NULL;
+    rawtext_len = 0;
+    if (!dat)
+        gli_fatal_error("data: Unexpected end of data object");
+
+    /* These bytes were counted when they were first read. */
+    data_bytes_read = bytesread;
+    return dat;
+}
+
 
 /* All the rest of this file is methods to allocate, free, parse, and 
    output the high-level data structures. */
@@ -1055,16 +1410,16 @@ data_metrics_t *data_metrics_parse(data_raw_t *rawdata)
 
 void data_metrics_print(FILE *fl, data_metrics_t *metrics)
 {
-    fprintf(fl, "{\n");   
-    fprintf(fl, "  \"width\": %.2f, \"height\": %.2f,\n", metrics->width, metrics->height);
-    fprintf(fl, "  \"outspacingx\": %.2f, \"outspacingy\": %.2f,\n", metrics->outspacingx, metrics->outspacingy);
-    fprintf(fl, "  \"inspacingx\": %.2f, \"inspacingy\": %.2f,\n", metrics->inspacingx, metrics->inspacingy);
-    fprintf(fl, "  \"gridcharwidth\": %.2f, \"gridcharheight\": %.2f,\n", metrics->gridcharwidth, metrics->gridcharheight);
-    fprintf(fl, "  \"gridmarginx\": %.2f, \"gridmarginy\": %.2f,\n", metrics->gridmarginx, metrics->gridmarginy);
-    fprintf(fl, "  \"buffercharwidth\": %.2f, \"buffercharheight\": %.2f,\n", metrics->buffercharwidth, metrics->buffercharheight);
-    fprintf(fl, "  \"buffermarginx\": %.2f, \"buffermarginy\": %.2f,\n", metrics->buffermarginx, metrics->buffermarginy);
-    fprintf(fl, "  \"graphicsmarginx\": %.2f, \"graphicsmarginy\": %.2f\n", metrics->graphicsmarginx, metrics->graphicsmarginy);
-    fprintf(fl, "}\n");   
+    DATA_FPRINTF(fl, "{\n");   
+    DATA_FPRINTF(fl, "  \"width\": %.2f, \"height\": %.2f,\n", metrics->width, metrics->height);
+    DATA_FPRINTF(fl, "  \"outspacingx\": %.2f, \"outspacingy\": %.2f,\n", metrics->outspacingx, metrics->outspacingy);
+    DATA_FPRINTF(fl, "  \"inspacingx\": %.2f, \"inspacingy\": %.2f,\n", metrics->inspacingx, metrics->inspacingy);
+    DATA_FPRINTF(fl, "  \"gridcharwidth\": %.2f, \"gridcharheight\": %.2f,\n", metrics->gridcharwidth, metrics->gridcharheight);
+    DATA_FPRINTF(fl, "  \"gridmarginx\": %.2f, \"gridmarginy\": %.2f,\n", metrics->gridmarginx, metrics->gridmarginy);
+    DATA_FPRINTF(fl, "  \"buffercharwidth\": %.2f, \"buffercharheight\": %.2f,\n", metrics->buffercharwidth, metrics->buffercharheight);
+    DATA_FPRINTF(fl, "  \"buffermarginx\": %.2f, \"buffermarginy\": %.2f,\n", metrics->buffermarginx, metrics->buffermarginy);
+    DATA_FPRINTF(fl, "  \"graphicsmarginx\": %.2f, \"graphicsmarginy\": %.2f\n", metrics->graphicsmarginx, metrics->graphicsmarginy);
+    DATA_FPRINTF(fl, "}\n");   
 }
 
 data_supportcaps_t *data_supportcaps_alloc()
@@ -1077,6 +1432,8 @@ data_supportcaps_t *data_supportcaps_alloc()
     supportcaps->graphicswin = FALSE;
     supportcaps->graphicsext = FALSE;
     supportcaps->sound = FALSE;
+    supportcaps->partialwindows = FALSE;
+    supportcaps->partialupdates = FALSE;
 
     return supportcaps;
 }
@@ -1089,6 +1446,8 @@ void data_supportcaps_clear(data_supportcaps_t *supportcaps)
     supportcaps->graphicswin = FALSE;
     supportcaps->graphicsext = FALSE;
     supportcaps->sound = FALSE;
+    supportcaps->partialwindows = FALSE;
+    supportcaps->partialupdates = FALSE;
 }
 
 void data_supportcaps_merge(data_supportcaps_t *supportcaps, data_supportcaps_t *other)
@@ -1105,6 +1464,10 @@ void data_supportcaps_merge(data_supportcaps_t *supportcaps, data_supportcaps_t
         supportcaps->graphicsext = TRUE;
     if (other->sound)
         supportcaps->sound = TRUE;
+    if (other->partialwindows)
+        supportcaps->partialwindows = TRUE;
+    if (other->partialupdates)
+        supportcaps->partialupdates = TRUE;
 }
 
 void data_supportcaps_free(data_supportcaps_t *supportcaps)
@@ -1133,48 +1496,158 @@ data_supportcaps_t *data_supportcaps_parse(data_raw_t *rawdata)
                 supportcaps->graphicsext = TRUE;
             if (data_raw_string_is(dat, "sound"))
                 supportcaps->sound = TRUE;
+            if (data_raw_string_is(dat, "partialwindows"))
+                supportcaps->partialwindows = TRUE;
+            if (data_raw_string_is(dat, "partialupdates"))
+                supportcaps->partialupdates = TRUE;
         }
     }
 
     return supportcaps;
 }
 
+data_subscription_t *data_subscription_alloc()
+{
+    data_subscription_t *subscription = (data_subscription_t *)malloc(sizeof(data_subscription_t));
+
+    subscription->all = FALSE;
+    subscription->buffer = FALSE;
+    subscription->grid = FALSE;
+    subscription->graphics = FALSE;
+    subscription->ids = NULL;
+    subscription->numids = 0;
+
+    return subscription;
+}
+
+void data_subscription_free(data_subscription_t *subscription)
+{
+    if (subscription->ids) {
+        free(subscription->ids);
+        subscription->ids = NULL;
+    }
+    free(subscription);
+}
+
+/* A subscription is a list of window type names and window ids, or null
+   to go back to seeing everything. */
+data_subscription_t *data_subscription_parse(data_raw_t *rawdata)
+{
+    data_subscription_t *subscription = data_subscription_alloc();
+    int ix;
+
+    if (rawdata->type == rawtyp_Null) {
+        subscription->all = TRUE;
+        return subscription;
+    }
+
+    if (rawdata->type != rawtyp_List)
+        gli_fatal_error("data: Subscription must be a list");
+
+    if (rawdata->count) {
+        subscription->ids = (glui32 *)malloc(rawdata->count * sizeof(glui32));
+        if (!subscription->ids)
+            gli_fatal_error("data: Unable to allocate memory for subscription");
+    }
+
+    for (ix=0; ix<rawdata->count; ix++) {
+        data_raw_t *dat = rawdata->list[ix];
+
+        if (dat->type == rawtyp_Number)
+            subscription->ids[subscription->numids++] = data_raw_int_value(dat);
+        else if (data_raw_string_is(dat, "buffer"))
+            subscription->buffer = TRUE;
+        else if (data_raw_string_is(dat, "grid"))
+            subscription->grid = TRUE;
+        else if (data_raw_string_is(dat, "graphics"))
+            subscription->graphics = TRUE;
+    }
+
+    return subscription;
+}
+
+/* The inverse of data_subscription_parse(). A NULL subscription means
+   all windows, and is printed as null. */
+void data_subscription_print(FILE *fl, data_subscription_t *subscription)
+{
+    int any = FALSE;
+    int ix;
+
+    if (!subscription || subscription->all) {
+        DATA_FPRINTF(fl, "null");
+        return;
+    }
+
+    DATA_FPRINTF(fl, "[");
+    if (subscription->buffer) {
+        if (any) DATA_FPRINTF(fl, ", ");
+        DATA_FPRINTF(fl, "\"buffer\"");
+        any = TRUE;
+    }
+    if (subscription->grid) {
+        if (any) DATA_FPRINTF(fl, ", ");
+        DATA_FPRINTF(fl, "\"grid\"");
+        any = TRUE;
+    }
+    if (subscription->graphics) {
+        if (any) DATA_FPRINTF(fl, ", ");
+        DATA_FPRINTF(fl, "\"graphics\"");
+        any = TRUE;
+    }
+    for (ix=0; ix<subscription->numids; ix++) {
+        if (any) DATA_FPRINTF(fl, ", ");
+        DATA_FPRINTF(fl, "%ld", (long)subscription->ids[ix]);
+        any = TRUE;
+    }
+    DATA_FPRINTF(fl, "]");
+}
+
 void data_supportcaps_print(FILE *fl, data_supportcaps_t *supportcaps)
 {
     int any = FALSE;
     
-    fprintf(fl, "[");
+    DATA_FPRINTF(fl, "[");
     if (supportcaps->timer) {
-        if (any) fprintf(fl, ", ");
-        fprintf(fl, "\"timer\"");
+        if (any) DATA_FPRINTF(fl, ", ");
+        DATA_FPRINTF(fl, "\"timer\"");
         any = TRUE;
     }
     if (supportcaps->hyperlinks) {
-        if (any) fprintf(fl, ", ");
-        fprintf(fl, "\"hyperlinks\"");
+        if (any) DATA_FPRINTF(fl, ", ");
+        DATA_FPRINTF(fl, "\"hyperlinks\"");
         any = TRUE;
     }
     if (supportcaps->graphics) {
-        if (any) fprintf(fl, ", ");
-        fprintf(fl, "\"graphics\"");
+        if (any) DATA_FPRINTF(fl, ", ");
+        DATA_FPRINTF(fl, "\"graphics\"");
         any = TRUE;
     }
     if (supportcaps->graphicswin) {
-        if (any) fprintf(fl, ", ");
-        fprintf(fl, "\"graphicswin\"");
+        if (any) DATA_FPRINTF(fl, ", ");
+        DATA_FPRINTF(fl, "\"graphicswin\"");
         any = TRUE;
     }
     if (supportcaps->graphicsext) {
-        if (any) fprintf(fl, ", ");
-        fprintf(fl, "\"graphicsext\"");
+        if (any) DATA_FPRINTF(fl, ", ");
+        DATA_FPRINTF(fl, "\"graphicsext\"");
         any = TRUE;
     }
     if (supportcaps->sound) {
-        if (any) fprintf(fl, ", ");
-        fprintf(fl, "\"sound\"");
+        if (any) DATA_FPRINTF(fl, ", ");
+        DATA_FPRINTF(fl, "\"sound\"");
+        any = TRUE;
+    }
+    if (supportcaps->partialwindows) {
+        if (any) DATA_FPRINTF(fl, ", ");
+        DATA_FPRINTF(fl, "\"partialwindows\"");
+        any = TRUE;
+    }
+    if (supportcaps->partialupdates) {
+        if (any) DATA_FPRINTF(fl, ", ");
+        DATA_FPRINTF(fl, "\"partialupdates\"");
         any = TRUE;
     }
-    fprintf(fl, "]\n");   
+    DATA_FPRINTF(fl, "]\n");   
 }
 
 void data_event_free(data_event_t *data)
@@ -1192,6 +1665,10 @@ void data_event_free(data_event_t *data)
         data_supportcaps_free(data->supportcaps);
         data->supportcaps = NULL;
     }
+    if (data->subscription) {
+        data_subscription_free(data->subscription);
+        data->subscription = NULL;
+    }
     free(data);
 }
 
@@ -1199,29 +1676,102 @@ void data_event_print(data_event_t *data)
 {
     switch (data->dtag) {
         case dtag_Init:
-            printf("{ \"type\": \"init\", \"gen\": %d, \"metrics\":\n",
+            DATA_PRINTF("{ \"type\": \"init\", \"gen\": %d, \"metrics\":\n",
                 data->gen);
             data_metrics_print(stdout, data->metrics);
             if (data->supportcaps) {
-                printf(", \"support\":\n");
+                DATA_PRINTF(", \"support\":\n");
                 data_supportcaps_print(stdout, data->supportcaps);
             }
-            printf("}\n");
+            DATA_PRINTF("}\n");
             break;
 
         /* ### Never got around to implementing the rest of this, did I... */
 
         default:
-            printf("{? unknown dtag %d}\n", data->dtag);
+            DATA_PRINTF("{? unknown dtag %d}\n", data->dtag);
             break;
     }
 }
 
+/* Read an input event. The client may send a list of events rather
+   than a single one; in that case we return the first, and keep the
+   rest queued up for later calls. */
 data_event_t *data_event_read()
 {
-    data_raw_t *dat;
+    while (eventqueuepos >= eventqueue.count) {
+        /* If this is an empty list, keep waiting. */
+        data_event_enqueue(data_raw_blockread(fastforwardfile ? fastforwardfile : stdin, NULL));
+    }
+
+    return eventqueue.list[eventqueuepos++];
+}
+
+/* Check whether an event is available, without blocking. If so, it is
+   queued up, and data_event_read() will return it. Queued input in the
+   -fastforward file doesn't count; we only look at stdin. */
+int data_event_poll()
+{
+    char termchar;
 
-    data_raw_t *rawdata = data_raw_blockread(stdin);
+    if (eventqueuepos < eventqueue.count)
+        return TRUE;
+    if (fastforwardfile)
+        return FALSE;
+
+    while (!input_object_ready()) {
+        if (!input_fill(FALSE))
+            return FALSE;
+    }
+
+    data_raw_t *rawdata = data_raw_blockread_sub(stdin, &termchar, NULL);
+    if (!rawdata)
+        gli_fatal_error("data: Unexpected end of data object");
+    data_event_enqueue(rawdata);
+    return (eventqueuepos < eventqueue.count);
+}
+
+/* Parse an input object, which may be a single event or a list of them,
+   and add the events to the queue. */
+static void data_event_enqueue(data_raw_t *rawdata)
+{
+    int ix;
+
+    if (eventqueuepos >= eventqueue.count) {
+        eventqueue.count = 0;
+        eventqueuepos = 0;
+    }
+
+    if (rawdata->type != rawtyp_List) {
+        gen_list_append(&eventqueue, data_event_parse(rawdata));
+        return;
+    }
+
+    for (ix=0; ix<rawdata->count; ix++)
+        gen_list_append(&eventqueue, data_event_parse(rawdata->list[ix]));
+}
+
+/* Return the next queued event (from a list sent by the client), without
+   removing it from the queue. If there is none, return NULL. */
+data_event_t *data_event_peek_queued()
+{
+    if (eventqueuepos < eventqueue.count)
+        return eventqueue.list[eventqueuepos];
+    return NULL;
+}
+
+/* Throw away any queued events. This is called when an update goes out
+   with a new generation number, since the queued events were sent with
+   the old one. */
+void data_event_discard_queued()
+{
+    while (eventqueuepos < eventqueue.count)
+        data_event_free(eventqueue.list[eventqueuepos++]);
+}
+
+static data_event_t *data_event_parse(data_raw_t *rawdata)
+{
+    data_raw_t *dat;
 
     if (rawdata->type != rawtyp_Struct)
         gli_fatal_error("data: Input struct not a struct");
@@ -1243,6 +1793,7 @@ data_event_t *data_event_read()
     input->mousey = 0;
     input->metrics = NULL;
     input->supportcaps = NULL;
+    input->subscription = NULL;
 
     if (data_raw_string_is(dat, "init")) {
         input->dtag = dtag_Init;
@@ -1261,6 +1812,11 @@ data_event_t *data_event_read()
         if (dat) {
             input->supportcaps = data_supportcaps_parse(dat);
         }
+
+        dat = data_raw_struct_field(rawdata, "subscribe");
+        if (dat) {
+            input->subscription = data_subscription_parse(dat);
+        }
     }
     else if (data_raw_string_is(dat, "refresh")) {
         input->dtag = dtag_Refresh;
@@ -1283,6 +1839,11 @@ data_event_t *data_event_read()
             gli_fatal_error("data: Arrange input struct has no metrics");
 
         input->metrics = data_metrics_parse(dat);
+
+        dat = data_raw_struct_field(rawdata, "subscribe");
+        if (dat) {
+            input->subscription = data_subscription_parse(dat);
+        }
     }
     else if (data_raw_string_is(dat, "redraw")) {
         input->dtag = dtag_Redraw;
@@ -1449,14 +2010,17 @@ data_update_t *data_update_alloc()
     data_update_t *dat = (data_update_t *)malloc(sizeof(data_update_t));
     if (!dat)
         gli_fatal_error("data: Unable to alloc update structure");
+    data_alloc_count++;
 
     dat->gen = 0;
     dat->usewindows = FALSE;
+    dat->partialwindows = FALSE;
     dat->useinputs = FALSE;
     dat->includetimer = FALSE;
     dat->timer = 0;
     dat->disable = FALSE;
     dat->exit = FALSE;
+    dat->partial = FALSE;
     dat->specialreq = NULL;
 
     gen_list_init(&dat->windows);
@@ -1507,78 +2071,97 @@ void data_update_print(data_update_t *dat)
 {
     int ix;
 
-    printf("{\"type\":\"update\", \"gen\":%d", dat->gen);
+    DATA_PRINTF("{\"type\":\"update\", \"gen\":%d", dat->gen);
 
     if (dat->usewindows) {
         data_window_t **winlist = (data_window_t **)(dat->windows.list);
-        printf(",\n \"windows\":[\n");
+        DATA_PRINTF(",\n \"windows\":[\n");
         for (ix=0; ix<dat->windows.count; ix++) {
             data_window_print(winlist[ix]);
             if (ix+1 < dat->windows.count)
-                printf(",");
-            printf("\n");
+                DATA_PRINTF(",");
+            DATA_PRINTF("\n");
         }
-        printf(" ]");
+        DATA_PRINTF(" ]");
+        if (dat->partialwindows)
+            DATA_PRINTF(",\n \"partialwindows\":true");
     }
 
     if (dat->contents.count) {
         data_content_t **contlist = (data_content_t **)(dat->contents.list);
-        printf(",\n \"content\":[\n");
+        DATA_PRINTF(",\n \"content\":[\n");
         for (ix=0; ix<dat->contents.count; ix++) {
             data_content_print(contlist[ix]);
             if (ix+1 < dat->contents.count)
-                printf(",");
-            printf("\n");
+                DATA_PRINTF(",");
+            DATA_PRINTF("\n");
         }
-        printf(" ]");
+        DATA_PRINTF(" ]");
     }
 
     if (dat->useinputs) {
         data_input_t **inplist = (data_input_t **)(dat->inputs.list);
-        printf(",\n \"input\":[\n");
+        DATA_PRINTF(",\n \"input\":[\n");
         for (ix=0; ix<dat->inputs.count; ix++) {
             data_input_print(inplist[ix]);
             if (ix+1 < dat->inputs.count)
-                printf(",");
-            printf("\n");
+                DATA_PRINTF(",");
+            DATA_PRINTF("\n");
         }
-        printf(" ]");
+        DATA_PRINTF(" ]");
     }
 
     if (dat->specialreq) {
-        printf(",\n \"specialinput\":\n");
+        DATA_PRINTF(",\n \"specialinput\":\n");
         data_specialreq_print(dat->specialreq);
     }
 
     if (dat->includetimer) {
-        printf(",\n \"timer\":");
+        DATA_PRINTF(",\n \"timer\":");
         if (!dat->timer)
-            printf("null");
+            DATA_PRINTF("null");
         else
-            printf("%d", dat->timer);
+            DATA_PRINTF("%d", dat->timer);
     }
 
     if (dat->disable) {
-        printf(",\n \"disable\":true");
+        DATA_PRINTF(",\n \"disable\":true");
     }
     
     if (dat->exit) {
-        printf(",\n \"exit\":true");
+        DATA_PRINTF(",\n \"exit\":true");
+    }
+
+    if (dat->partial) {
+        DATA_PRINTF(",\n \"partial\":true");
     }
 
     if (dat->debuglines.count) {
         char **debuglist = (char **)(dat->debuglines.list);
-        printf(",\n \"debugoutput\":[\n");
+        DATA_PRINTF(",\n \"debugoutput\":[\n");
         for (ix=0; ix<dat->debuglines.count; ix++) {
             print_utf8string_json(debuglist[ix], stdout);
             if (ix+1 < dat->debuglines.count)
-                printf(",");
-            printf("\n");
+                DATA_PRINTF(",");
+            DATA_PRINTF("\n");
         }
-        printf(" ]");
+        DATA_PRINTF(" ]");
     }
 
-    printf("}\n");
+    DATA_PRINTF("}\n");
+}
+
+void data_error_print(char *msg)
+{
+    DATA_PRINTF("{\"type\":\"error\", \"message\":");
+    print_string_json(msg, stdout);
+    DATA_PRINTF("}\n");
+}
+
+/* Every stanza on stdout is followed by a blank line. */
+void data_stanza_end()
+{
+    DATA_PRINTF("\n");
 }
 
 data_window_t *data_window_alloc(glui32 window, glui32 type, glui32 rock)
@@ -1586,6 +2169,7 @@ data_window_t *data_window_alloc(glui32 window, glui32 type, glui32 rock)
     data_window_t *dat = (data_window_t *)malloc(sizeof(data_window_t));
     if (!dat)
         gli_fatal_error("data: Unable to alloc window structure");
+    data_alloc_count++;
 
     dat->window = window;
     dat->type = type;
@@ -1621,12 +2205,12 @@ void data_window_print(data_window_t *dat)
             break;
     }
 
-    printf(" { \"id\":%d, \"type\":\"%s\", \"rock\":%d,\n", dat->window, typename, dat->rock);
+    DATA_PRINTF(" { \"id\":%d, \"type\":\"%s\", \"rock\":%d,\n", dat->window, typename, dat->rock);
     if (dat->type == wintype_TextGrid)
-        printf("   \"gridwidth\":%d, \"gridheight\":%d,\n", dat->gridwidth, dat->gridheight);
+        DATA_PRINTF("   \"gridwidth\":%d, \"gridheight\":%d,\n", dat->gridwidth, dat->gridheight);
     if (dat->type == wintype_Graphics)
-        printf("   \"graphwidth\":%d, \"graphheight\":%d,\n", dat->gridwidth, dat->gridheight);
-    printf("   \"left\":%d, \"top\":%d, \"width\":%d, \"height\":%d }",
+        DATA_PRINTF("   \"graphwidth\":%d, \"graphheight\":%d,\n", dat->gridwidth, dat->gridheight);
+    DATA_PRINTF("   \"left\":%d, \"top\":%d, \"width\":%d, \"height\":%d }",
         dat->size.left, dat->size.top, dat->size.right-dat->size.left, dat->size.bottom-dat->size.top);
 }
 
@@ -1635,6 +2219,7 @@ data_input_t *data_input_alloc(glui32 window, glui32 evtype)
     data_input_t *dat = (data_input_t *)malloc(sizeof(data_input_t));
     if (!dat)
         gli_fatal_error("data: Unable to alloc input structure");
+    data_alloc_count++;
 
     dat->window = window;
     dat->evtype = evtype;
@@ -1667,34 +2252,34 @@ void data_input_free(data_input_t *dat)
 
 void data_input_print(data_input_t *dat)
 {
-    printf(" {\"id\":%d, \"gen\":%d", dat->window, dat->gen);
+    DATA_PRINTF(" {\"id\":%d, \"gen\":%d", dat->window, dat->gen);
 
     switch (dat->evtype) {
         case evtype_CharInput:
-            printf(", \"type\":\"char\"");
+            DATA_PRINTF(", \"type\":\"char\"");
             break;
         case evtype_LineInput:
-            printf(", \"type\":\"line\", \"maxlen\":%d", dat->maxlen);
+            DATA_PRINTF(", \"type\":\"line\", \"maxlen\":%d", dat->maxlen);
             if (dat->initstr && dat->initlen) {
-                printf(", \"initial\":");
+                DATA_PRINTF(", \"initial\":");
                 print_ustring_len_json(dat->initstr, dat->initlen, stdout);
             }
             break;
     }
 
     if (dat->cursorpos) {
-        printf(", \"xpos\":%d, \"ypos\":%d", dat->xpos, dat->ypos);
+        DATA_PRINTF(", \"xpos\":%d, \"ypos\":%d", dat->xpos, dat->ypos);
     }
 
     if (dat->hyperlink) {
-        printf(", \"hyperlink\":true");
+        DATA_PRINTF(", \"hyperlink\":true");
     }
 
     if (dat->mouse) {
-        printf(", \"mouse\":true");
+        DATA_PRINTF(", \"mouse\":true");
     }
 
-    printf(" }");
+    DATA_PRINTF(" }");
 }
 
 data_content_t *data_content_alloc(glui32 window, glui32 type)
@@ -1702,6 +2287,7 @@ data_content_t *data_content_alloc(glui32 window, glui32 type)
     data_content_t *dat = (data_content_t *)malloc(sizeof(data_content_t));
     if (!dat)
         gli_fatal_error("data: Unable to alloc content structure");
+    data_alloc_count++;
 
     dat->window = window;
     dat->type = type;
@@ -1736,30 +2322,30 @@ void data_content_print(data_content_t *dat)
         if (dat->clear)
             isclear = ", \"clear\":true";
         linelabel = "text";
-        printf(" {\"id\":%d%s", dat->window, isclear);
+        DATA_PRINTF(" {\"id\":%d%s", dat->window, isclear);
     }
     else if (dat->type == wintype_TextGrid) {
         linelabel = "lines";
-        printf(" {\"id\":%d", dat->window);
+        DATA_PRINTF(" {\"id\":%d", dat->window);
     }
     else if (dat->type == wintype_Graphics) {
         linelabel = "draw";
-        printf(" {\"id\":%d", dat->window);
+        DATA_PRINTF(" {\"id\":%d", dat->window);
     }
     else {
         gli_fatal_error("data: Unknown window type in content_print");
     }
 
     if (dat->lines.count) {
-        printf(", \"%s\": [\n", linelabel);
+        DATA_PRINTF(", \"%s\": [\n", linelabel);
 
         if (dat->type != wintype_Graphics) {
             data_line_t **linelist = (data_line_t **)(dat->lines.list);
             for (ix=0; ix<dat->lines.count; ix++) {
                 data_line_print(linelist[ix], dat->type);
                 if (ix+1 < dat->lines.count)
-                    printf(",");
-                printf("\n");
+                    DATA_PRINTF(",");
+                DATA_PRINTF("\n");
             }
         }
         else {
@@ -1770,16 +2356,16 @@ void data_content_print(data_content_t *dat)
                 for (ix=0; ix<line->count; ix++) {
                     data_specialspan_print(line->spans[ix].special, dat->type);
                     if (ix+1 < line->count)
-                        printf(",");
-                    printf("\n");
+                        DATA_PRINTF(",");
+                    DATA_PRINTF("\n");
                 }
             }
         }
 
-        printf(" ]");
+        DATA_PRINTF(" ]");
     }
 
-    printf(" }");
+    DATA_PRINTF(" }");
 }
 
 data_line_t *data_line_alloc()
@@ -1787,6 +2373,7 @@ data_line_t *data_line_alloc()
     data_line_t *dat = (data_line_t *)malloc(sizeof(data_line_t));
     if (!dat)
         gli_fatal_error("data: Unable to alloc line structure");
+    data_alloc_count++;
 
     dat->append = FALSE;
     dat->flowbreak = FALSE;
@@ -1873,30 +2460,30 @@ void data_line_print(data_line_t *dat, glui32 wintype)
     int ix;
     int any = FALSE;
 
-    printf("  {");
+    DATA_PRINTF("  {");
 
     if (wintype == wintype_TextGrid) {
-        printf(" \"line\":%d", dat->linenum);
+        DATA_PRINTF(" \"line\":%d", dat->linenum);
         any = TRUE;
     }
     else {
         if (dat->append) {
-            printf("\"append\":true");
+            DATA_PRINTF("\"append\":true");
             any = TRUE;
         }
         if (dat->flowbreak) {
             if (any)
-                printf(", ");
-            printf("\"flowbreak\":true");
+                DATA_PRINTF(", ");
+            DATA_PRINTF("\"flowbreak\":true");
             any = TRUE;
         }
     }
 
     if (dat->count) {
         if (any)
-            printf(", ");
+            DATA_PRINTF(", ");
 
-        printf("\"content\":[");
+        DATA_PRINTF("\"content\":[");
         
         for (ix=0; ix<dat->count; ix++) {
             data_span_t *span = &(dat->spans[ix]);
@@ -1905,21 +2492,21 @@ void data_line_print(data_line_t *dat, glui32 wintype)
             }
             else {
                 char *stylename = name_for_style(span->style);
-                printf("{ \"style\":\"%s\"", stylename);
+                DATA_PRINTF("{ \"style\":\"%s\"", stylename);
                 if (span->hyperlink)
-                    printf(", \"hyperlink\":%ld", (unsigned long)span->hyperlink);
-                printf(", \"text\":");
+                    DATA_PRINTF(", \"hyperlink\":%ld", (unsigned long)span->hyperlink);
+                DATA_PRINTF(", \"text\":");
                 print_ustring_len_json(span->str, span->len, stdout);
-                printf("}");
+                DATA_PRINTF("}");
             }
             if (ix+1 < dat->count)
-                printf(", ");
+                DATA_PRINTF(", ");
         }
         
-        printf("]");
+        DATA_PRINTF("]");
     }
 
-    printf("}");
+    DATA_PRINTF("}");
 
 }
 
@@ -1928,6 +2515,7 @@ data_specialspan_t *data_specialspan_alloc(SpecialType type)
     data_specialspan_t *dat = (data_specialspan_t *)malloc(sizeof(data_specialspan_t));
     if (!dat)
         gli_fatal_error("data: Unable to alloc specialspan structure");
+    data_alloc_count++;
 
     dat->type = type;
     dat->chunktype = 0;
@@ -1965,28 +2553,28 @@ void data_specialspan_print(data_specialspan_t *dat, glui32 wintype)
     switch (dat->type) {
 
     case specialtype_Image:
-        printf("{\"special\":\"image\", \"image\":%d", dat->image);
+        DATA_PRINTF("{\"special\":\"image\", \"image\":%d", dat->image);
         
         if (wintype == wintype_Graphics) {
-            printf(", \"width\":%d, \"height\":%d", dat->width, dat->height);
-            printf(", \"x\":%d, \"y\":%d", dat->xpos, dat->ypos);
+            DATA_PRINTF(", \"width\":%d, \"height\":%d", dat->width, dat->height);
+            DATA_PRINTF(", \"x\":%d, \"y\":%d", dat->xpos, dat->ypos);
         }
         else {
             if (dat->width)
-                printf(", \"width\":%d", dat->width);
+                DATA_PRINTF(", \"width\":%d", dat->width);
             if (dat->height)
-                printf(", \"height\":%d", dat->height);
+                DATA_PRINTF(", \"height\":%d", dat->height);
             if (dat->widthratio)
-                printf(", \"widthratio\":%.4f", dat->widthratio);
+                DATA_PRINTF(", \"widthratio\":%.4f", dat->widthratio);
             if (dat->aspectwidth)
-                printf(", \"aspectwidth\":%.2f", dat->aspectwidth);
+                DATA_PRINTF(", \"aspectwidth\":%.2f", dat->aspectwidth);
             if (dat->aspectheight)
-                printf(", \"aspectheight\":%.2f", dat->aspectheight);
+                DATA_PRINTF(", \"aspectheight\":%.2f", dat->aspectheight);
             if (dat->winmaxwidth) {
                 if (dat->winmaxwidth < 0.0)
-                    printf(", \"winmaxwidth\":null");
+                    DATA_PRINTF(", \"winmaxwidth\":null");
                 else
-                    printf(", \"winmaxwidth\":%.4f", dat->winmaxwidth);
+                    DATA_PRINTF(", \"winmaxwidth\":%.4f", dat->winmaxwidth);
             }
         }
 
@@ -1996,7 +2584,7 @@ void data_specialspan_print(data_specialspan_t *dat, glui32 wintype)
                 suffix = ".jpeg";
             else if (dat->chunktype == 0x504E4720)
                 suffix = ".png";
-            printf(", \"url\":\"%spict-%d%s\"", pref_resourceurl, dat->image, suffix);
+            DATA_PRINTF(", \"url\":\"%spict-%d%s\"", pref_resourceurl, dat->image, suffix);
         }
 
         if (wintype != wintype_Graphics) {
@@ -2019,42 +2607,42 @@ void data_specialspan_print(data_specialspan_t *dat, glui32 wintype)
                 alignment = "marginright";
                 break;
             }
-            printf(", \"alignment\":\"%s\"", alignment);
+            DATA_PRINTF(", \"alignment\":\"%s\"", alignment);
         }
 
         if (dat->hyperlink)
-            printf(", \"hyperlink\":\"%d\"", dat->hyperlink);
+            DATA_PRINTF(", \"hyperlink\":\"%d\"", dat->hyperlink);
         if (dat->alttext) {
             /* ### not sure what format the alt-text is in yet */
-            printf(", \"alttext\":\"###\"");
+            DATA_PRINTF(", \"alttext\":\"###\"");
         }
-        printf("}");
+        DATA_PRINTF("}");
         break;
 
     case specialtype_FlowBreak:
-        printf("{\"text\":\"[ERROR: data_specialspan_print: flowbreak should have been converted to a line flag]\"}");
+        DATA_PRINTF("{\"text\":\"[ERROR: data_specialspan_print: flowbreak should have been converted to a line flag]\"}");
         break;
 
     case specialtype_SetColor:
-        printf("{\"special\":\"setcolor\"");
+        DATA_PRINTF("{\"special\":\"setcolor\"");
         if (dat->hascolor)
-            printf(", \"color\":\"#%06X\"", dat->color);
-        printf("}");
+            DATA_PRINTF(", \"color\":\"#%06X\"", dat->color);
+        DATA_PRINTF("}");
         break;
 
     case specialtype_Fill:
-        printf("{\"special\":\"fill\"");
+        DATA_PRINTF("{\"special\":\"fill\"");
         if (dat->hasdimensions)
-            printf(", \"x\":%d, \"y\":%d", dat->xpos, dat->ypos);
+            DATA_PRINTF(", \"x\":%d, \"y\":%d", dat->xpos, dat->ypos);
         if (dat->hasdimensions)
-            printf(", \"width\":%d, \"height\":%d", dat->width, dat->height);
+            DATA_PRINTF(", \"width\":%d, \"height\":%d", dat->width, dat->height);
         if (dat->hascolor)
-            printf(", \"color\":\"#%06X\"", dat->color);
-        printf("}");
+            DATA_PRINTF(", \"color\":\"#%06X\"", dat->color);
+        DATA_PRINTF("}");
         break;
 
     default:
-        printf("{\"text\":\"[ERROR: data_specialspan_print: unrecognized special type]\"}");
+        DATA_PRINTF("{\"text\":\"[ERROR: data_specialspan_print: unrecognized special type]\"}");
         break;
 
     }
@@ -2063,44 +2651,44 @@ void data_specialspan_print(data_specialspan_t *dat, glui32 wintype)
 /* Complete dump for autosave. */
 void data_specialspan_auto_print(FILE *file, data_specialspan_t *dat)
 {
-    fprintf(file, "{\"type\":%d", (int)dat->type);
+    DATA_FPRINTF(file, "{\"type\":%d", (int)dat->type);
 
     if (dat->image)
-        fprintf(file, ", \"image\":%ld", (long)dat->image);
+        DATA_FPRINTF(file, ", \"image\":%ld", (long)dat->image);
     if (dat->chunktype)
-        fprintf(file, ", \"chunktype\":%ld", (long)dat->chunktype);
+        DATA_FPRINTF(file, ", \"chunktype\":%ld", (long)dat->chunktype);
     if (dat->hasdimensions)
-        fprintf(file, ", \"hasdimensions\":true");
+        DATA_FPRINTF(file, ", \"hasdimensions\":true");
 
     if (dat->xpos || dat->ypos)
-        fprintf(file, ", \"xpos\":%ld, \"ypos\":%ld", (long)dat->xpos, (long)dat->ypos);
+        DATA_FPRINTF(file, ", \"xpos\":%ld, \"ypos\":%ld", (long)dat->xpos, (long)dat->ypos);
     if (dat->width || dat->height)
-        fprintf(file, ", \"width\":%ld, \"height\":%ld", (long)dat->width, (long)dat->height);
+        DATA_FPRINTF(file, ", \"width\":%ld, \"height\":%ld", (long)dat->width, (long)dat->height);
     if (dat->widthratio)
-        fprintf(file, ", \"widthratio\":%.4f", dat->widthratio);
+        DATA_FPRINTF(file, ", \"widthratio\":%.4f", dat->widthratio);
     if (dat->aspectwidth)
-        fprintf(file, ", \"aspectwidth\":%.4f", dat->aspectwidth);
+        DATA_FPRINTF(file, ", \"aspectwidth\":%.4f", dat->aspectwidth);
     if (dat->aspectheight)
-        fprintf(file, ", \"aspectheight\":%.4f", dat->aspectheight);
+        DATA_FPRINTF(file, ", \"aspectheight\":%.4f", dat->aspectheight);
     /* negative winmaxwidth is stored as-is, not as "null" */
     if (dat->winmaxwidth)
-        fprintf(file, ", \"winmaxwidth\":%.4f", dat->winmaxwidth);
+        DATA_FPRINTF(file, ", \"winmaxwidth\":%.4f", dat->winmaxwidth);
     if (dat->alignment)
-        fprintf(file, ", \"alignment\":%ld", (long)dat->alignment);
+        DATA_FPRINTF(file, ", \"alignment\":%ld", (long)dat->alignment);
     if (dat->hyperlink)
-        fprintf(file, ", \"hyperlink\":%ld", (long)dat->hyperlink);
+        DATA_FPRINTF(file, ", \"hyperlink\":%ld", (long)dat->hyperlink);
 
     if (dat->alttext) {
-        fprintf(file, ", \"alttext\":");
+        DATA_FPRINTF(file, ", \"alttext\":");
         print_string_json(dat->alttext, file);
     }
     
     if (dat->hascolor)
-        fprintf(file, ", \"hascolor\":true");
+        DATA_FPRINTF(file, ", \"hascolor\":true");
     if (dat->color)
-        fprintf(file, ", \"color\":%ld", (long)dat->color);
+        DATA_FPRINTF(file, ", \"color\":%ld", (long)dat->color);
 
-    fprintf(file, "}");
+    DATA_FPRINTF(file, "}");
 }
 
 data_specialspan_t *data_specialspan_auto_parse(data_raw_t *rawdata)
@@ -2246,13 +2834,13 @@ void data_specialreq_print(data_specialreq_t *dat)
             break;
     }
 
-    printf("  { \"type\":\"%s\", \"filemode\":\"%s\", \"filetype\":\"%s\"", 
+    DATA_PRINTF("  { \"type\":\"%s\", \"filemode\":\"%s\", \"filetype\":\"%s\"", 
         "fileref_prompt", filemode, filetype);
     if (dat->gameid) {
-        printf(",\n    \"gameid\":");
+        DATA_PRINTF(",\n    \"gameid\":");
         print_string_json(dat->gameid, stdout);
     }
-    printf(" }");
+    DATA_PRINTF(" }");
 }
 
 data_tempbufinfo_t *data_tempbufinfo_alloc()
@@ -2296,7 +2884,7 @@ void data_grect_clear(grect_t *box)
 
 void data_grect_print(FILE *file, grect_t *box)
 {
-    fprintf(file, "{\"left\":%d, \"top\":%d, \"right\":%d, \"bottom\":%d}",
+    DATA_FPRINTF(file, "{\"left\":%d, \"top\":%d, \"right\":%d, \"bottom\":%d}",
         box->left, box->top, box->right, box->bottom);
 }
 
@@ -2330,6 +2918,7 @@ glkunix_library_state_t glkunix_library_state_alloc()
 
     state->metrics = NULL;
     state->supportcaps = NULL;
+    state->subscription = NULL;
     state->windowlist = NULL;
     state->streamlist = NULL;
     state->filereflist = NULL;
@@ -2354,6 +2943,11 @@ void glkunix_library_state_free(glkunix_library_state_t state)
         state->supportcaps = NULL;
     }
 
+    if (state->subscription) {
+        data_subscription_free(state->subscription);
+        state->subscription = NULL;
+    }
+
     if (state->windowlist) {
         for (ix=0; ix<state->windowcount; ix++) {
             winid_t win = state->windowlist[ix];
@@ -2462,12 +3056,15 @@ static glkunix_unserialize_context_t glkunix_unserialize_context_alloc()
     return ctx;
 }
 
-int glkunix_unserialize_object_root(FILE *file, glkunix_unserialize_context_t ctx)
+/* Read the object. Fields with keys in rawkeys (a NULL-terminated list,
+   or NULL) are kept as unparsed text, to be decoded later (if ever) by
+   glkunix_unserialize_decode_raw_fields(). */
+int glkunix_unserialize_object_root(FILE *file, glkunix_unserialize_context_t ctx, char **rawkeys)
 {
     ctx->dat = NULL;
     ctx->subctx = NULL;
     
-    ctx->dat = data_raw_blockread(file);
+    ctx->dat = data_raw_blockread(file, rawkeys);
     if (!ctx->dat)
         return FALSE;
 
@@ -2595,6 +3192,105 @@ int glkunix_unserialize_len_unicode(glkunix_unserialize_context_t ctx, char *key
     return TRUE;
 }
 
+/* Remove the named fields from a struct, and gather them into a new struct
+   (which is returned). Fields which are not present are skipped. The caller
+   owns the result, and should eventually pass it to 
+   glkunix_unserialize_object_root_finalize() as the root of a context.
+
+   This lets us hang onto a chunk of the autorestore data after the rest
+   of it has been freed. */
+data_raw_t *glkunix_unserialize_detach_fields(glkunix_unserialize_context_t ctx, char **keys)
+{
+    data_raw_t *res = data_raw_alloc(rawtyp_Struct);
+    data_raw_t *dat = ctx->dat;
+    char **keyptr;
+    int ix;
+
+    if (dat->type != rawtyp_Struct)
+        gli_fatal_error("data: Need struct");
+
+    for (keyptr=keys; *keyptr; keyptr++) {
+        data_raw_t *subdat = data_raw_struct_field(dat, *keyptr);
+        if (!subdat)
+            continue;
+        for (ix=0; ix<dat->count; ix++) {
+            if (dat->list[ix] == subdat)
+                break;
+        }
+        if (ix+1 < dat->count)
+            memmove(&dat->list[ix], &dat->list[ix+1], (dat->count-(ix+1)) * sizeof(data_raw_t *));
+        dat->count--;
+        data_raw_ensure_size(res, res->count+1);
+        res->list[res->count++] = subdat;
+    }
+
+    return res;
+}
+
+/* Parse any fields of the struct which were left as unparsed text by
+   glkunix_unserialize_object_root(). */
+void glkunix_unserialize_decode_raw_fields(glkunix_unserialize_context_t ctx)
+{
+    data_raw_t *dat = ctx->dat;
+    int ix;
+
+    if (dat->type != rawtyp_Struct)
+        gli_fatal_error("data: Need struct");
+
+    for (ix=0; ix<dat->count; ix++) {
+        data_raw_t *subdat = dat->list[ix];
+        if (subdat->type == rawtyp_Raw) {
+            data_raw_t *newdat = data_raw_parse_rawtext(subdat);
+            newdat->key = subdat->key;
+            newdat->keylen = subdat->keylen;
+            subdat->key = NULL;
+            data_raw_free(subdat);
+            dat->list[ix] = newdat;
+        }
+    }
+}
+
+/* Write out the fields taken by glkunix_unserialize_detach_fields(),
+   unchanged. Each is preceded by a comma, so this goes in the middle
+   of an object. */
+void glkunix_serialize_detached_fields(FILE *fl, data_raw_t *dat)
+{
+    int ix;
+
+    for (ix=0; ix<dat->count; ix++) {
+        data_raw_t *subdat = dat->list[ix];
+        DATA_FPRINTF(fl, ",\n");
+        print_ustring_len_json(subdat->key, subdat->keylen, fl);
+        DATA_FPRINTF(fl, ":");
+        data_raw_fprint(fl, subdat);
+    }
+}
+
+/* Like glkunix_unserialize_len_unicode(), except that the string is
+   handed over rather than copied. The field is left as an empty string.
+   Use this only on data which will be discarded afterwards. */
+int glkunix_unserialize_take_len_unicode(glkunix_unserialize_context_t ctx, char *key, glui32 **res, long *reslen)
+{
+    data_raw_t *dat = data_raw_struct_field(ctx->dat, key);
+    if (!dat)
+        return FALSE;
+
+    if (dat->type != rawtyp_Str)
+        gli_fatal_error("data: Need str");
+
+    if (!dat->str) {
+        *res = data_raw_str_dup(dat);
+        *reslen = 0;
+        return TRUE;
+    }
+
+    *res = dat->str;
+    *reslen = dat->count;
+    dat->str = NULL;
+    dat->count = 0;
+    return TRUE;
+}
+
 int glkunix_unserialize_struct(glkunix_unserialize_context_t ctx, char *key, glkunix_unserialize_context_t *subctx)
 {
     *subctx = NULL;
@@ -71,6 +71,20 @@ struct data_supportcaps_struct {
     int graphicswin;
     int graphicsext;
     int sound;
+    int partialwindows;
+    int partialupdates;
+};
+
+/* data_subscription_t: Which windows the client wants to see content
+   for. A window is included if its type is flagged, or if its id is in
+   the list. */
+struct data_subscription_struct {
+    int all;
+    int buffer;
+    int grid;
+    int graphics;
+    glui32 *ids;
+    int numids;
 };
 
 /* data_event_t: Represents an input event (either the initial setup event,
@@ -88,6 +102,7 @@ struct data_event_struct {
     glui32 mousey;
     data_metrics_t *metrics;
     data_supportcaps_t *supportcaps;
+    data_subscription_t *subscription;
 };
 
 /* data_update_t: Represents a complete output update, including what
@@ -95,6 +110,7 @@ struct data_event_struct {
 struct data_update_struct {
     glsi32 gen;
     int usewindows;
+    int partialwindows; /* windows lists only the windows which changed */
     gen_list_t windows; /* data_window_t */
     gen_list_t contents; /* data_content_t */
     int useinputs;
@@ -105,6 +121,7 @@ struct data_update_struct {
     gen_list_t debuglines; /* char* (null-terminated UTF8) */
     int disable;
     int exit;
+    int partial; /* sent mid-turn; more output will follow */
 };
 
 /* data_window_t: Represents one window, either newly created, resized, or
@@ -210,6 +227,12 @@ struct data_tempbufinfo_struct {
 };
 
 extern void gli_initialize_datainput(void);
+extern void gli_initialize_fastforward(char *pathname);
+extern int data_fastforward_pending(void);
+
+extern glui32 data_bytes_read;
+extern glui32 data_bytes_written;
+extern glui32 data_alloc_count;
 
 extern void print_ustring_len_json(glui32 *buf, glui32 len, FILE *fl);
 extern void print_utf8string_json(char *buf, FILE *fl);
@@ -231,14 +254,23 @@ extern void data_supportcaps_merge(data_supportcaps_t *supportcaps, data_support
 extern void data_supportcaps_free(data_supportcaps_t *supportcaps);
 extern void data_supportcaps_print(FILE *fl, data_supportcaps_t *supportcaps);
 extern data_supportcaps_t *data_supportcaps_parse(data_raw_t *rawdata);
+extern data_subscription_t *data_subscription_alloc(void);
+extern void data_subscription_free(data_subscription_t *subscription);
+extern data_subscription_t *data_subscription_parse(data_raw_t *rawdata);
+extern void data_subscription_print(FILE *fl, data_subscription_t *subscription);
 
 extern data_event_t *data_event_read(void);
+extern int data_event_poll(void);
+extern data_event_t *data_event_peek_queued(void);
+extern void data_event_discard_queued(void);
 extern void data_event_free(data_event_t *data);
 extern void data_event_print(data_event_t *data);
 
 extern data_update_t *data_update_alloc(void);
 extern void data_update_free(data_update_t *data);
 extern void data_update_print(data_update_t *data);
+extern void data_error_print(char *msg);
+extern void data_stanza_end(void);
 
 extern data_window_t *data_window_alloc(glui32 window, glui32 type, glui32 rock);
 extern void data_window_free(data_window_t *data);
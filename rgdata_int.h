@@ -21,6 +21,7 @@ struct glkunix_library_state_struct {
     glui32 generation;
     data_metrics_t *metrics;
     data_supportcaps_t *supportcaps;
+    data_subscription_t *subscription;
 
     window_t **windowlist;
     int windowcount;
@@ -48,8 +49,12 @@ extern int glkunix_unserialize_real(glkunix_unserialize_context_t, char *, doubl
 extern int glkunix_unserialize_latin1_string(glkunix_unserialize_context_t, char *, char **);
 extern int glkunix_unserialize_len_bytes(glkunix_unserialize_context_t, char *, unsigned char **, long *);
 extern int glkunix_unserialize_len_unicode(glkunix_unserialize_context_t, char *, glui32 **, long *);
+extern int glkunix_unserialize_take_len_unicode(glkunix_unserialize_context_t, char *, glui32 **, long *);
+extern data_raw_t *glkunix_unserialize_detach_fields(glkunix_unserialize_context_t, char **);
+extern void glkunix_unserialize_decode_raw_fields(glkunix_unserialize_context_t);
+extern void glkunix_serialize_detached_fields(FILE *, data_raw_t *);
 
 extern int glkunix_unserialize_uint32_list_entry(glkunix_unserialize_context_t, int, glui32 *);
 
-extern int glkunix_unserialize_object_root(FILE *file, struct glkunix_unserialize_context_struct *ctx);
+extern int glkunix_unserialize_object_root(FILE *file, struct glkunix_unserialize_context_struct *ctx, char **rawkeys);
 extern void glkunix_unserialize_object_root_finalize(struct glkunix_unserialize_context_struct *ctx);
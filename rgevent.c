@@ -26,10 +26,13 @@ static glui32 last_event_type;
 static glui32 timing_msec; 
 /* The last timing value that was sent out. (0 means null was sent.) */
 static glui32 last_timing_msec;
-/* When the current timer started or last fired. */
+/* When the current timer started or last fired (by CLOCK_MONOTONIC). */
 static struct timespec timing_start; 
 
 static glsi32 gli_timer_request_since_start(void);
+static int gli_queued_event_acceptable(void);
+static data_event_t *gli_select_read_event(void);
+static void gli_select_background_event(data_event_t *data);
 static char *alloc_utf_buffer(glui32 *ustr, int ulen);
 
 /* Set up the input system. This is called from main(). */
@@ -42,24 +45,55 @@ void gli_initialize_events()
 
 void glk_select(event_t *event)
 {
+    unsigned long long tracestart = 0;
+
     curevent = event;
     gli_event_clearevent(curevent);
     
+    if (gli_turnstats)
+        gli_turnstats_end(gli_phase_Compute);
+
+#ifdef GI_DISPA_PROFILE
+    gli_profile_poll();
+#endif /* GI_DISPA_PROFILE */
+
     if (gli_debugger)
         gidebug_announce_cycle(gidebug_cycle_InputWait);
 
     /* Send an update stanza to stdout. We do this before every glk_select,
-       including at startup, but *not* if we just autorestored. */
-    if (last_event_type != 0xFFFFFFFE) {
+       including at startup, but *not* if we just autorestored. We also
+       skip it if the client sent a list of events and the next one is
+       still good; the changes pile up until the list is used up. */
+    if (last_event_type != 0xFFFFFFFE && !gli_queued_event_acceptable()) {
         gli_windows_update(NULL, TRUE, FALSE);
-        if (pref_singleturn) {
+        if (pref_singleturn && !gli_fastforwarding) {
             /* Singleton mode mode means that we exit after every output. */
             gli_fast_exit();
         }
     }
     
+    if (gli_tracing) {
+        /* The update is out and the client is busy with it, so this is
+           a good time to write out trace data. */
+        gli_trace_flush();
+        tracestart = gli_trace_now();
+    }
+
     while (curevent->type == evtype_None) {
-        data_event_t *data = data_event_read();
+        if (gli_fastforwarding && !data_fastforward_pending() && !data_event_peek_queued()) {
+            /* The queued input ran out partway through this wait (after
+               an arrange event, say). The update we skipped is needed
+               after all. */
+            gli_windows_update(NULL, FALSE, FALSE);
+            if (pref_singleturn)
+                gli_fast_exit();
+        }
+
+        if (gli_turnstats)
+            gli_turnstats_begin(gli_phase_Wait);
+        data_event_t *data = gli_select_read_event();
+        if (gli_turnstats)
+            gli_turnstats_end(gli_phase_Parse);
         
         window_t *win = NULL;
         glui32 val;
@@ -73,21 +107,15 @@ void glk_select(event_t *event)
                    a (real) event. */
                 gli_windows_refresh(data->gen);
                 gli_windows_update(NULL, FALSE, FALSE);
-                if (pref_singleturn) {
+                if (pref_singleturn && !gli_fastforwarding) {
                     gli_fast_exit();
                 }
                 break;
 
             case dtag_Arrange:
-                gli_windows_metrics_change(data->metrics);
-                break;
-
             case dtag_Redraw:
-                if (data->window)
-                    win = glkunix_window_find_by_updatetag(data->window);
-                else
-                    win = NULL;
-                gli_event_store(evtype_Redraw, win, 0, 0);
+            case dtag_Timer:
+                gli_select_background_event(data);
                 break;
 
             case dtag_Line:
@@ -140,17 +168,23 @@ void glk_select(event_t *event)
                 gli_event_store(evtype_MouseInput, win, data->mousex, data->mousey);
                 break;
 
-            case dtag_Timer:
-                timespec_get(&timing_start, TIME_UTC);
-                gli_event_store(evtype_Timer, NULL, 0, 0);
-                break;
-
             case dtag_DebugInput:
                 if (gli_debugger) {
                     /* If debug support is compiled in *and* turned on:
                        process the command, send an update, and
                        continue the glk_select. */
                     char *allocbuf = alloc_utf_buffer(data->linevalue, data->linelen);
+#ifdef GI_DISPA_PROFILE
+                    /* One debug command belongs to the library rather
+                       than the game. */
+                    if (!strcmp(allocbuf, "glkprofile")) {
+                        if (gli_profile_write())
+                            gidebug_output("Dispatch profile written.");
+                        else
+                            gidebug_output("Unable to write dispatch profile.");
+                    }
+                    else
+#endif /* GI_DISPA_PROFILE */
                     gidebug_perform_command(allocbuf);
                     free(allocbuf);
 
@@ -172,7 +206,13 @@ void glk_select(event_t *event)
     }
     
     /* An event has occurred; glk_select() is over. */
+    if (gli_tracing)
+        gli_trace_span("wait", "select", tracestart);
+    if (gli_turnstats)
+        gli_turnstats_begin(gli_phase_Trim);
     gli_windows_trim_buffers();
+    if (gli_turnstats)
+        gli_turnstats_end_turn(); /* this ends the trim phase */
     last_event_type = curevent->type;
     curevent = NULL;
 
@@ -185,14 +225,28 @@ void glk_select_poll(event_t *event)
     curevent = event;
     gli_event_clearevent(curevent);
 
-    /* We can only sensibly check for unfired timer events. */
-    /* ### This is not consistent with the modern understanding that
-       the display layer handles timer events. Might want to just rip
-       all this timing code out entirely. */
-    if (timing_msec) {
+    /* See whether the client has sent an event which can be delivered
+       here: arrange, redraw, or timer. Anything else has to wait for
+       glk_select(), and so does everything which arrived after it. This
+       does not block. */
+    if (data_event_poll()) {
+        data_event_t *data = data_event_peek_queued();
+        if (data->dtag == dtag_Arrange || data->dtag == dtag_Redraw
+            || data->dtag == dtag_Timer) {
+            data = gli_select_read_event();
+            if (data->gen != gli_window_current_generation())
+                gli_fatal_error("Input generation number does not match.");
+            gli_select_background_event(data);
+            data_event_free(data);
+        }
+    }
+
+    /* If the client hasn't sent a timer event, but the interval has
+       passed, fire it here. */
+    if (curevent->type == evtype_None && timing_msec) {
         glsi32 time = gli_timer_request_since_start();
         if (time >= 0 && time >= timing_msec) {
-            timespec_get(&timing_start, TIME_UTC);
+            clock_gettime(CLOCK_MONOTONIC, &timing_start);
             /* Resend timer request at next update. */
             last_timing_msec = 0;
             /* Call it a timer event. */
@@ -203,6 +257,102 @@ void glk_select_poll(event_t *event)
     curevent = NULL;
 }
 
+/* Read the next input event. When the client's window is resized, it
+   may send a burst of arrange events; if more than one has arrived, we
+   skip to the last, so that the windows are only laid out once. Repeated
+   refresh requests are likewise merged into one. This doesn't wait for
+   more input. */
+static data_event_t *gli_select_read_event()
+{
+    data_event_t *data = data_event_read();
+
+    while ((data->dtag == dtag_Arrange || data->dtag == dtag_Refresh)
+        && data_event_poll()) {
+        data_event_t *next = data_event_peek_queued();
+        if (next->dtag != data->dtag)
+            break;
+        if (data->dtag == dtag_Arrange && next->gen != data->gen)
+            break;
+        if (data->subscription) {
+            /* The later event may not carry a subscription list, so
+               this one still counts. */
+            gli_windows_subscribe(data->subscription);
+            data->subscription = NULL;
+        }
+        data_event_free(data);
+        data = data_event_read();
+    }
+
+    return data;
+}
+
+/* Handle an event which the game may receive from either glk_select() or
+   glk_select_poll(). */
+static void gli_select_background_event(data_event_t *data)
+{
+    window_t *win;
+
+    switch (data->dtag) {
+        case dtag_Arrange:
+            if (data->subscription) {
+                gli_windows_subscribe(data->subscription);
+                data->subscription = NULL;
+            }
+            gli_windows_metrics_change(data->metrics);
+            break;
+
+        case dtag_Redraw:
+            if (data->window)
+                win = glkunix_window_find_by_updatetag(data->window);
+            else
+                win = NULL;
+            gli_event_store(evtype_Redraw, win, 0, 0);
+            break;
+
+        case dtag_Timer:
+            clock_gettime(CLOCK_MONOTONIC, &timing_start);
+            gli_event_store(evtype_Timer, NULL, 0, 0);
+            break;
+
+        default:
+            break;
+    }
+}
+
+/* Check whether the next event queued up from the client's last list
+   of events can be handled without the client seeing an update first.
+   That's true unless it's input for a window which isn't waiting for
+   that kind of input anymore. (The game may have cancelled a line
+   request and asked for a character, say.) In that case the rest of the
+   list is stale; the update will go out and the list will be dropped. */
+static int gli_queued_event_acceptable()
+{
+    data_event_t *data = data_event_peek_queued();
+    window_t *win;
+
+    if (!data)
+        return FALSE;
+
+    switch (data->dtag) {
+        case dtag_Line:
+            win = glkunix_window_find_by_updatetag(data->window);
+            return (win && win->line_request);
+        case dtag_Char:
+            win = glkunix_window_find_by_updatetag(data->window);
+            return (win && win->char_request);
+        case dtag_Hyperlink:
+            win = glkunix_window_find_by_updatetag(data->window);
+            return (win && win->hyperlink_request);
+        case dtag_Mouse:
+            win = glkunix_window_find_by_updatetag(data->window);
+            return (win && win->mouse_request);
+        case dtag_SpecialResponse:
+            return FALSE;
+        default:
+            return TRUE;
+    }
+}
+
 /* Wait for input, but it has to be a metrics object. Store the result. */
 void gli_select_metrics(data_metrics_t *metrics, data_supportcaps_t *supportcaps)
 {
@@ -213,6 +363,11 @@ void gli_select_metrics(data_metrics_t *metrics, data_supportcaps_t *supportcaps
 
     *metrics = *data->metrics;
 
+    if (data->subscription) {
+        gli_windows_subscribe(data->subscription);
+        data->subscription = NULL;
+    }
+
     if (data->supportcaps) {
         *supportcaps = *data->supportcaps;
     }
@@ -237,7 +392,7 @@ char *gli_select_specialrequest(data_specialreq_t *special)
        get_by_prompt, but *not* if we just autorestored. */
     if (last_event_type != 0xFFFFFFFE) {
         gli_windows_update(special, TRUE, FALSE);
-        if (pref_singleturn) {
+        if (pref_singleturn && !gli_fastforwarding) {
             /* Singleton mode mode means that we exit after every output. */
             gli_fast_exit();
         }
@@ -385,7 +540,7 @@ void glk_request_timer_events(glui32 millisecs)
     if (!gli_supportcaps.timer)
         return;
     timing_msec = millisecs;
-    timespec_get(&timing_start, TIME_UTC);
+    clock_gettime(CLOCK_MONOTONIC, &timing_start);
 }
 
 /* Return whether the timer request has changed since the last call.
@@ -419,7 +574,7 @@ static glsi32 gli_timer_request_since_start()
     if (!timing_msec)
         return -1;
 
-    timespec_get(&ts, TIME_UTC);
+    clock_gettime(CLOCK_MONOTONIC, &ts);
 
     if (ts.tv_sec < timing_start.tv_sec) {
         return 0;
@@ -7,6 +7,13 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#ifdef GI_DISPA_PROFILE
+#include <signal.h>
+#endif /* GI_DISPA_PROFILE */
+#ifndef NO_MMAP
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif /* NO_MMAP */
 #include "glk.h"
 #include "remglk.h"
 #include "rgdata.h"
@@ -69,6 +76,14 @@ void glk_exit()
     if (gli_debugger)
         gidebug_announce_cycle(gidebug_cycle_End);
 
+    if (gli_turnstats)
+        gli_turnstats_finish();
+    if (gli_tracing)
+        gli_trace_finish();
+#ifdef GI_DISPA_PROFILE
+    gli_profile_write();
+#endif /* GI_DISPA_PROFILE */
+
     exit(0);
 }
 
@@ -166,11 +181,9 @@ void gli_display_warning(char *msg)
         fprintf(stderr, "Glk library error: %s\n", msg);
     }
     else {
-        printf("{\"type\":\"error\", \"message\":");
-        print_string_json(msg, stdout);
-        printf("}\n");
+        data_error_print(msg);
     }
-    printf("\n"); /* blank line after stanza */
+    data_stanza_end();
     fflush(stdout);
 }
 
@@ -180,15 +193,60 @@ void gli_display_error(char *msg)
         fprintf(stderr, "%s\n", msg);
     }
     else {
-        printf("{\"type\":\"error\", \"message\":");
-        print_string_json(msg, stdout);
-        printf("}\n");
+        data_error_print(msg);
     }
-    printf("\n"); /* blank line after stanza */
+    data_stanza_end();
     fflush(stdout);
+    gli_streams_flush_all();
+    if (gli_turnstats)
+        gli_turnstats_finish();
+    if (gli_tracing)
+        gli_trace_finish();
     exit(1);
 }
 
+/* Map an open file read-only into memory, and return the address (and
+   its length in *len). The mapping outlives the FILE, so the caller can
+   close it afterwards. Returns NULL if the file can't be mapped -- empty,
+   too large, not a regular file, or NO_MMAP was defined at compile time.
+   The caller should fall back to reading the file in that case. */
+void *gli_map_file(FILE *fl, glui32 *len)
+{
+    *len = 0;
+
+#ifndef NO_MMAP
+    {
+        struct stat st;
+        void *ptr;
+        int fd = fileno(fl);
+
+        if (fd < 0 || fstat(fd, &st) != 0)
+            return NULL;
+        if (!S_ISREG(st.st_mode) || st.st_size <= 0)
+            return NULL;
+        if ((unsigned long long)st.st_size > 0xFFFFFFFFULL)
+            return NULL;
+
+        ptr = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+        if (ptr == MAP_FAILED)
+            return NULL;
+
+        *len = (glui32)st.st_size;
+        return ptr;
+    }
+#else /* NO_MMAP */
+    return NULL;
+#endif /* NO_MMAP */
+}
+
+void gli_unmap_file(void *ptr, glui32 len)
+{
+#ifndef NO_MMAP
+    if (ptr)
+        munmap(ptr, len);
+#endif /* NO_MMAP */
+}
+
 #ifdef NO_MEMMOVE
 
 void *memmove(void *destp, void *srcp, int n)
@@ -217,3 +275,78 @@ void *memmove(void *destp, void *srcp, int n)
 }
 
 #endif /* NO_MEMMOVE */
+
+#ifdef GI_DISPA_PROFILE
+
+/* Set by the SIGUSR1 handler; the statistics are written out at the
+   next glk_select(), which is a safe place to do file I/O. */
+static volatile sig_atomic_t profile_requested = FALSE;
+
+static void gli_profile_signal(int sig)
+{
+    profile_requested = TRUE;
+}
+
+/* Set up the dispatch profiler. This is called from main(). */
+void gli_initialize_profile()
+{
+    signal(SIGUSR1, gli_profile_signal);
+}
+
+/* Write the dispatch layer's call statistics as JSON, to the -profile
+   file if one was given, or else stderr. Functions which have never
+   been called are left out. Returns FALSE if the file can't be written. */
+int gli_profile_write()
+{
+    FILE *fl;
+    glui32 ix, jx, kx, count;
+    int first = TRUE;
+
+    if (pref_profilepath) {
+        fl = fopen(pref_profilepath, "w");
+        if (!fl)
+            return FALSE;
+    }
+    else {
+        fl = stderr;
+    }
+
+    fprintf(fl, "{\"functions\":[");
+    count = gidispatch_count_functions();
+    for (ix=0; ix<count; ix++) {
+        gidispatch_function_t *func = gidispatch_get_function(ix);
+        gidispatch_profile_t *prof = gidispatch_get_profile(ix);
+        if (!prof->calls)
+            continue;
+        fprintf(fl, "%s\n {\"id\":%ld, \"name\":\"%s\", \"calls\":%llu, \"nanos\":%llu, \"bytes\":%llu, \"histogram\":[",
+            (first ? "" : ","), (long)func->id, func->name,
+            prof->calls, prof->nanos, prof->bytes);
+        first = FALSE;
+        /* Leave off the empty buckets at the slow end. */
+        for (jx=GIDISPATCH_PROFILE_BUCKETS; jx>1; jx--) {
+            if (prof->histogram[jx-1])
+                break;
+        }
+        for (kx=0; kx<jx; kx++)
+            fprintf(fl, "%s%ld", (kx ? "," : ""), (long)prof->histogram[kx]);
+        fprintf(fl, "]}");
+    }
+    fprintf(fl, "\n]}\n");
+
+    if (fl == stderr)
+        fflush(fl);
+    else
+        fclose(fl);
+    return TRUE;
+}
+
+/* Write the statistics if a SIGUSR1 has come in since the last check. */
+void gli_profile_poll()
+{
+    if (profile_requested) {
+        profile_requested = FALSE;
+        gli_profile_write();
+    }
+}
+
+#endif /* GI_DISPA_PROFILE */
@@ -0,0 +1,200 @@
+/* rgstats.c: Per-turn timing statistics
+        for RemGlk, remote-procedure-call implementation of the Glk API.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "glk.h"
+#include "remglk.h"
+#include "rgdata.h"
+
+/* With the -turnstats option, we time the phases of every turn and
+   write one line of JSON per turn to the named file. A turn runs from
+   one glk_select() returning to the next one returning. At exit, we
+   append a summary line with percentiles for each phase.
+
+   The clock is CLOCK_MONOTONIC, so the times are unaffected by changes
+   to the wall clock. All times are in nanoseconds. */
+
+int gli_turnstats = FALSE;
+
+static char *phase_names[gli_phase_Count] = {
+    "compute", "build", "serialize", "flush", "wait", "parse", "trim",
+};
+
+typedef struct turnstats_struct {
+    unsigned long long nanos[gli_phase_Count];
+    long bytesin;
+    long bytesout;
+    long allocs;
+} turnstats_t;
+
+static FILE *statsfile = NULL;
+static glui32 turncount = 0;
+
+/* The turn in progress, and the phases currently being timed. */
+static turnstats_t curturn;
+static struct timespec phasestart[gli_phase_Count];
+static int phaserunning[gli_phase_Count];
+
+/* Counter values at the start of the turn. */
+static glui32 lastbytesread;
+static glui32 lastbyteswritten;
+static glui32 lastalloccount;
+
+/* The phase times of every finished turn, for the summary. Entry
+   gli_phase_Count holds the turn totals. */
+static unsigned long long *history[gli_phase_Count+1];
+static glui32 historysize = 0;
+
+static void turnstats_write(void);
+
+/* Set up the statistics file. This is called from main(), if the
+   -turnstats option was given. */
+void gli_initialize_turnstats(char *pathname)
+{
+    statsfile = fopen(pathname, "w");
+    if (!statsfile) {
+        gli_strict_warning("unable to open turn statistics file");
+        return;
+    }
+
+    gli_turnstats = TRUE;
+    memset(&curturn, 0, sizeof(curturn));
+    memset(phaserunning, 0, sizeof(phaserunning));
+    lastbytesread = data_bytes_read;
+    lastbyteswritten = data_bytes_written;
+    lastalloccount = data_alloc_count;
+
+    gli_turnstats_begin(gli_phase_Compute);
+}
+
+void gli_turnstats_begin(int phase)
+{
+    clock_gettime(CLOCK_MONOTONIC, &phasestart[phase]);
+    phaserunning[phase] = TRUE;
+}
+
+void gli_turnstats_end(int phase)
+{
+    struct timespec now;
+
+    if (!phaserunning[phase])
+        return;
+    phaserunning[phase] = FALSE;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    curturn.nanos[phase] += (unsigned long long)(now.tv_sec - phasestart[phase].tv_sec) * 1000000000
+        + now.tv_nsec - phasestart[phase].tv_nsec;
+}
+
+/* End one phase and begin another -- but only if the first one was
+   running. Returns whether it was. */
+int gli_turnstats_switch(int fromphase, int tophase)
+{
+    if (!phaserunning[fromphase])
+        return FALSE;
+    gli_turnstats_end(fromphase);
+    gli_turnstats_begin(tophase);
+    return TRUE;
+}
+
+/* Finish off the current turn: write it out, remember it for the
+   summary, and start timing the game's computation for the next one.
+   This is called when glk_select() is about to return. */
+void gli_turnstats_end_turn()
+{
+    turnstats_write();
+    gli_turnstats_begin(gli_phase_Compute);
+}
+
+static void turnstats_write()
+{
+    int ix;
+    unsigned long long total;
+
+    for (ix=0; ix<gli_phase_Count; ix++)
+        gli_turnstats_end(ix);
+
+    curturn.bytesin = data_bytes_read - lastbytesread;
+    curturn.bytesout = data_bytes_written - lastbyteswritten;
+    curturn.allocs = data_alloc_count - lastalloccount;
+    lastbytesread = data_bytes_read;
+    lastbyteswritten = data_bytes_written;
+    lastalloccount = data_alloc_count;
+
+    if (turncount >= historysize) {
+        historysize = (historysize ? historysize*2 : 64);
+        for (ix=0; ix<=gli_phase_Count; ix++) {
+            history[ix] = realloc(history[ix], historysize * sizeof(unsigned long long));
+            if (!history[ix])
+                gli_fatal_error("turnstats: Unable to allocate memory");
+        }
+    }
+
+    total = 0;
+    fprintf(statsfile, "{\"turn\":%ld", (long)turncount);
+    for (ix=0; ix<gli_phase_Count; ix++) {
+        fprintf(statsfile, ", \"%s\":%llu", phase_names[ix], curturn.nanos[ix]);
+        history[ix][turncount] = curturn.nanos[ix];
+        total += curturn.nanos[ix];
+    }
+    history[gli_phase_Count][turncount] = total;
+    fprintf(statsfile, ", \"total\":%llu", total);
+    fprintf(statsfile, ", \"bytesin\":%ld", curturn.bytesin);
+    fprintf(statsfile, ", \"bytesout\":%ld", curturn.bytesout);
+    fprintf(statsfile, ", \"allocs\":%ld}\n", curturn.allocs);
+
+    turncount++;
+    memset(&curturn, 0, sizeof(curturn));
+}
+
+static int compare_nanos(const void *v1, const void *v2)
+{
+    unsigned long long n1 = *(unsigned long long *)v1;
+    unsigned long long n2 = *(unsigned long long *)v2;
+    if (n1 < n2)
+        return -1;
+    if (n1 > n2)
+        return 1;
+    return 0;
+}
+
+/* Nearest-rank percentile of a sorted list. */
+static unsigned long long percentile(unsigned long long *list, glui32 count,
+    int pc)
+{
+    glui32 pos = (count * pc + 99) / 100;
+    if (pos < 1)
+        pos = 1;
+    return list[pos-1];
+}
+
+/* Write out the last (partial) turn and the summary, and close the
+   file. This is called at exit. */
+void gli_turnstats_finish()
+{
+    int ix;
+
+    if (!gli_turnstats)
+        return;
+    gli_turnstats = FALSE;
+
+    turnstats_write();
+
+    fprintf(statsfile, "{\"summary\":{\"turns\":%ld", (long)turncount);
+    for (ix=0; ix<=gli_phase_Count; ix++) {
+        unsigned long long *list = history[ix];
+        qsort(list, turncount, sizeof(unsigned long long), compare_nanos);
+        fprintf(statsfile, ", \"%s\":{\"p50\":%llu, \"p90\":%llu, \"p99\":%llu, \"max\":%llu}",
+            ((ix < gli_phase_Count) ? phase_names[ix] : "total"),
+            percentile(list, turncount, 50), percentile(list, turncount, 90),
+            percentile(list, turncount, 99), list[turncount-1]);
+    }
+    fprintf(statsfile, "}}\n");
+
+    fclose(statsfile);
+    statsfile = NULL;
+}
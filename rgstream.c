@@ -27,6 +27,22 @@ static glui32 tagcounter = 0;
 static stream_t *gli_streamlist = NULL; /* linked list of all streams */
 stream_t *gli_currentstr = NULL; /* the current output stream */
 
+/* Unicode file streams encode and decode through a buffer of this size,
+   rather than making four stdio calls per character. */
+#define FILEBUF_SIZE (4096)
+
+static void gli_stream_file_write(stream_t *str, glui32 len);
+static void gli_stream_file_sync(stream_t *str);
+static int gli_stream_file_fill(stream_t *str);
+static void gli_stream_file_put_uni(stream_t *str, glui32 *buf, glui32 len);
+
+/* Read one byte from a unicode file stream's buffer, refilling it if
+   necessary. Evaluates to -1 at end of file. */
+#define FILEBUF_GETC(str)  \
+    (((str)->filebufpos < (str)->filebuflen) \
+        ? (str)->filebuf[(str)->filebufpos++] \
+        : gli_stream_file_fill(str))
+
 void gli_initialize_streams()
 {
     tagcounter = (random() % 15) + 32;
@@ -72,6 +88,9 @@ stream_t *gli_new_stream(int type, int readable, int writable,
     str->file = NULL;
     str->filename = NULL;
     str->modestr = NULL;
+    str->filebuf = NULL;
+    str->filebufpos = 0;
+    str->filebuflen = 0;
     str->fileresnum = 0;
     str->lastop = 0;
     str->buf = NULL;
@@ -124,6 +143,9 @@ stream_t *gli_stream_alloc_inactive()
     str->file = NULL;
     str->filename = NULL;
     str->modestr = NULL;
+    str->filebuf = NULL;
+    str->filebufpos = 0;
+    str->filebuflen = 0;
     str->fileresnum = 0;
     str->lastop = 0;
     str->buf = NULL;
@@ -160,6 +182,11 @@ void gli_stream_dealloc_inactive(stream_t *str)
         str->modestr = NULL;
     }
     
+    if (str->filebuf) {
+        free(str->filebuf);
+        str->filebuf = NULL;
+    }
+    
     if (str->tempbufinfo) {
         data_tempbufinfo_free(str->tempbufinfo);
         str->tempbufinfo = NULL;
@@ -171,6 +198,7 @@ void gli_stream_dealloc_inactive(stream_t *str)
 void gli_delete_stream(stream_t *str)
 {
     stream_t *prev, *next;
+    unsigned long long tracestart = 0;
     
     if (str == gli_currentstr) {
         gli_currentstr = NULL;
@@ -198,9 +226,18 @@ void gli_delete_stream(stream_t *str)
             break;
         case strtype_File:
             /* close the FILE */
+            if (gli_tracing)
+                tracestart = gli_trace_now();
+            gli_stream_file_sync(str);
             fclose(str->file);
+            if (gli_tracing)
+                gli_trace_span("close", "file", tracestart);
             str->file = NULL;
             str->lastop = 0;
+            if (str->filebuf) {
+                free(str->filebuf);
+                str->filebuf = NULL;
+            }
             break;
     }
 
@@ -378,6 +415,21 @@ void gli_streams_close_all()
     }
 }
 
+/* Push all buffered file output through to the FILE (and the disk).
+   This is used at autosave time, and before a fatal-error exit. */
+void gli_streams_flush_all()
+{
+    stream_t *str;
+
+    for (str=gli_streamlist; str; str=str->next) {
+        if (str->type == strtype_File && str->file) {
+            if (str->filebuf && str->lastop == filemode_Write)
+                gli_stream_file_sync(str);
+            fflush(str->file);
+        }
+    }
+}
+
 strid_t glk_stream_open_memory(char *buf, glui32 buflen, glui32 fmode, 
     glui32 rock)
 {
@@ -435,6 +487,7 @@ strid_t glk_stream_open_file(fileref_t *fref, glui32 fmode,
     stream_t *str;
     char modestr[16];
     FILE *fl;
+    unsigned long long tracestart = 0;
     
     if (!fref) {
         gli_strict_warning("stream_open_file: invalid fileref ref.");
@@ -482,7 +535,11 @@ strid_t glk_stream_open_file(fileref_t *fref, glui32 fmode,
     if (!fref->textmode)
         strcat(modestr, "b");
         
+    if (gli_tracing)
+        tracestart = gli_trace_now();
     fl = fopen(fref->filename, modestr);
+    if (gli_tracing)
+        gli_trace_span("open", "file", tracestart);
     if (!fl) {
         /* According to recent spec discussion, we only display an error on missing files for write/append mode. In read mode, we return silently. */
         if (fmode != filemode_Read) {
@@ -579,6 +636,7 @@ strid_t glk_stream_open_resource(glui32 filenum, glui32 rock)
     strid_t str;
     int isbinary;
     giblorb_err_t err;
+    unsigned long long tracestart = 0;
     giblorb_result_t res;
 
     if (gli_get_dataresource_info(filenum, &res.data.ptr, &res.length, &isbinary)) {
@@ -591,7 +649,11 @@ strid_t glk_stream_open_resource(glui32 filenum, glui32 rock)
         if (!map)
             return 0; /* Not running from a blorb file */
 
+        if (gli_tracing)
+            tracestart = gli_trace_now();
         err = giblorb_load_resource(map, giblorb_method_Memory, &res, giblorb_ID_Data, filenum);
+        if (gli_tracing)
+            gli_trace_span("load", "blorb", tracestart);
         if (err)
             return 0; /* Not found, or some other error */
 
@@ -645,6 +707,7 @@ strid_t glk_stream_open_resource_uni(glui32 filenum, glui32 rock)
     strid_t str;
     int isbinary;
     giblorb_err_t err;
+    unsigned long long tracestart = 0;
     giblorb_result_t res;
 
     if (gli_get_dataresource_info(filenum, &res.data.ptr, &res.length, &isbinary)) {
@@ -657,7 +720,11 @@ strid_t glk_stream_open_resource_uni(glui32 filenum, glui32 rock)
         if (!map)
             return 0; /* Not running from a blorb file */
 
+        if (gli_tracing)
+            tracestart = gli_trace_now();
         err = giblorb_load_resource(map, giblorb_method_Memory, &res, giblorb_ID_Data, filenum);
+        if (gli_tracing)
+            gli_trace_span("load", "blorb", tracestart);
         if (err)
             return 0; /* Not found, or some other error */
 
@@ -705,6 +772,7 @@ strid_t gli_stream_open_pathname(char *pathname, int writemode,
     char modestr[16];
     stream_t *str;
     FILE *fl;
+    unsigned long long tracestart = 0;
     
     if (!writemode)
         strcpy(modestr, "r");
@@ -713,7 +781,11 @@ strid_t gli_stream_open_pathname(char *pathname, int writemode,
     if (!textmode)
         strcat(modestr, "b");
         
+    if (gli_tracing)
+        tracestart = gli_trace_now();
     fl = fopen(pathname, modestr);
+    if (gli_tracing)
+        gli_trace_span("open", "file", tracestart);
     if (!fl) {
         return 0;
     }
@@ -829,6 +901,7 @@ void glk_stream_set_position(stream_t *str, glsi32 pos, glui32 seekmode)
             break;
         case strtype_File:
             /* Either reading or writing is legal after an fseek. */
+            gli_stream_file_sync(str);
             str->lastop = 0;
             if (str->unicode) {
                 /* Use 4 here, rather than sizeof(glui32). */
@@ -862,8 +935,14 @@ glui32 glk_stream_get_position(stream_t *str)
                 return ftell(str->file);
             }
             else {
+                /* Account for bytes sitting in our buffer. */
+                long pos = ftell(str->file);
+                if (str->lastop == filemode_Write)
+                    pos += str->filebuflen;
+                else if (str->lastop == filemode_Read)
+                    pos -= (str->filebuflen - str->filebufpos);
                 /* Use 4 here, rather than sizeof(glui32). */
-                return ftell(str->file) / 4;
+                return pos / 4;
             }
         case strtype_Window:
         default:
@@ -876,12 +955,122 @@ static void gli_stream_ensure_op(stream_t *str, glui32 op)
     /* We have to do an fseek() between reading and writing. This will
        only come up for ReadWrite or WriteAppend files. */
     if (str->lastop != 0 && str->lastop != op) {
+        gli_stream_file_sync(str);
         long pos = ftell(str->file);
         fseek(str->file, pos, SEEK_SET);
     }
     str->lastop = op;
 }
 
+/* Write the first len bytes of a unicode file stream's buffer to its
+   FILE. */
+static void gli_stream_file_write(stream_t *str, glui32 len)
+{
+    unsigned long long tracestart = 0;
+
+    if (gli_tracing)
+        tracestart = gli_trace_now();
+    fwrite(str->filebuf, 1, len, str->file);
+    if (gli_tracing)
+        gli_trace_span("write", "file", tracestart);
+}
+
+/* Bring a unicode file stream's FILE into agreement with our buffer:
+   write out pending output, or seek back over read-ahead that hasn't
+   been consumed. Afterwards the buffer is empty. */
+static void gli_stream_file_sync(stream_t *str)
+{
+    if (!str->filebuf)
+        return;
+
+    if (str->lastop == filemode_Write) {
+        if (str->filebuflen)
+            gli_stream_file_write(str, str->filebuflen);
+    }
+    else if (str->lastop == filemode_Read) {
+        if (str->filebufpos < str->filebuflen)
+            fseek(str->file, -(long)(str->filebuflen - str->filebufpos), SEEK_CUR);
+    }
+
+    str->filebufpos = 0;
+    str->filebuflen = 0;
+}
+
+/* Refill the read buffer of a unicode file stream, and return the first
+   byte (or -1 at end of file). Only call this when the buffer is
+   exhausted; FILEBUF_GETC() does that. */
+static int gli_stream_file_fill(stream_t *str)
+{
+    unsigned long long tracestart = 0;
+
+    if (!str->filebuf) {
+        str->filebuf = (unsigned char *)malloc(FILEBUF_SIZE);
+        if (!str->filebuf)
+            return -1;
+    }
+
+    str->filebufpos = 0;
+    if (gli_tracing)
+        tracestart = gli_trace_now();
+    str->filebuflen = fread(str->filebuf, 1, FILEBUF_SIZE, str->file);
+    if (gli_tracing)
+        gli_trace_span("read", "file", tracestart);
+    if (str->filebuflen == 0)
+        return -1;
+
+    return str->filebuf[str->filebufpos++];
+}
+
+/* Encode an array of characters onto a unicode file stream: UTF-8 for
+   text files, four-byte big-endian for binary files. The caller must
+   already have called gli_stream_ensure_op(str, filemode_Write). */
+static void gli_stream_file_put_uni(stream_t *str, glui32 *buf, glui32 len)
+{
+    unsigned char *ptr, *end;
+    glui32 lx;
+
+    if (!str->filebuf) {
+        str->filebuf = (unsigned char *)malloc(FILEBUF_SIZE);
+        if (!str->filebuf)
+            return;
+        str->filebuflen = 0;
+    }
+
+    ptr = str->filebuf + str->filebuflen;
+    /* Leave room for the longest encoding of one character. */
+    end = str->filebuf + FILEBUF_SIZE - 4;
+
+    if (str->isbinary) {
+        for (lx=0; lx<len; lx++) {
+            glui32 ch = buf[lx];
+            if (ptr > end) {
+                gli_stream_file_write(str, ptr - str->filebuf);
+                ptr = str->filebuf;
+            }
+            ptr[0] = ((ch >> 24) & 0xFF);
+            ptr[1] = ((ch >> 16) & 0xFF);
+            ptr[2] = ((ch >>  8) & 0xFF);
+            ptr[3] = ( ch        & 0xFF);
+            ptr += 4;
+        }
+    }
+    else {
+        for (lx=0; lx<len; lx++) {
+            glui32 ch = buf[lx];
+            if (ptr > end) {
+                gli_stream_file_write(str, ptr - str->filebuf);
+                ptr = str->filebuf;
+            }
+            if (ch < 0x80)
+                *ptr++ = ch;
+            else
+                ptr += gli_encode_utf8(ch, (char *)ptr, 4);
+        }
+    }
+
+    str->filebuflen = ptr - str->filebuf;
+}
+
 static void gli_put_char(stream_t *str, unsigned char ch)
 {
     if (!str || !str->writable)
@@ -923,17 +1112,8 @@ static void gli_put_char(stream_t *str, unsigned char ch)
                 putc(ch, str->file);
             }
             else {
-                if (!str->isbinary) {
-                    /* cheap UTF-8 stream */
-                    gli_putchar_utf8(ch, str->file);
-                }
-                else {
-                    /* cheap big-endian stream */
-                    putc(0, str->file);
-                    putc(0, str->file);
-                    putc(0, str->file);
-                    putc(ch, str->file);
-                }
+                glui32 uch = ch;
+                gli_stream_file_put_uni(str, &uch, 1);
             }
             break;
         case strtype_Resource:
@@ -989,17 +1169,7 @@ static void gli_put_char_uni(stream_t *str, glui32 ch)
                 putc(ch, str->file);
             }
             else {
-                if (!str->isbinary) {
-                    /* cheap UTF-8 stream */
-                    gli_putchar_utf8(ch, str->file);
-                }
-                else {
-                    /* cheap big-endian stream */
-                    putc(((ch >> 24) & 0xFF), str->file);
-                    putc(((ch >> 16) & 0xFF), str->file);
-                    putc(((ch >>  8) & 0xFF), str->file);
-                    putc( (ch        & 0xFF), str->file);
-                }
+                gli_stream_file_put_uni(str, &ch, 1);
             }
             break;
         case strtype_Resource:
@@ -1010,6 +1180,26 @@ static void gli_put_char_uni(stream_t *str, glui32 ch)
 
 #endif /* GLK_MODULE_UNICODE */
 
+/* Write an array of characters. Unicode file streams take the whole
+   array in one pass; everything else goes character by character. */
+static void gli_put_buffer_uni(stream_t *str, glui32 *buf, glui32 len)
+{
+    glui32 lx;
+
+    if (!str || !str->writable)
+        return;
+
+    if (str->type == strtype_File && str->unicode) {
+        str->writecount += len;
+        gli_stream_ensure_op(str, filemode_Write);
+        gli_stream_file_put_uni(str, buf, len);
+        return;
+    }
+
+    for (lx=0; lx<len; lx++)
+        gli_put_char_uni(str, buf[lx]);
+}
+
 static void gli_put_buffer(stream_t *str, char *buf, glui32 len)
 {
     unsigned char *cx;
@@ -1082,20 +1272,16 @@ static void gli_put_buffer(stream_t *str, char *buf, glui32 len)
                 fwrite((unsigned char *)buf, 1, len, str->file);
             }
             else {
-                if (!str->isbinary) {
-                    /* cheap UTF-8 stream */
-                    for (lx=0; lx<len; lx++)
-                        gli_putchar_utf8(((unsigned char *)buf)[lx], str->file);
-                }
-                else {
-                    /* cheap big-endian stream */
-                    for (lx=0; lx<len; lx++) {
-                        unsigned char ch = ((unsigned char *)buf)[lx];
-                        putc(((ch >> 24) & 0xFF), str->file);
-                        putc(((ch >> 16) & 0xFF), str->file);
-                        putc(((ch >>  8) & 0xFF), str->file);
-                        putc( (ch        & 0xFF), str->file);
-                    }
+                glui32 ubuf[64];
+                glui32 count;
+                for (lx=0; lx<len; lx+=count) {
+                    glui32 ix;
+                    count = len - lx;
+                    if (count > 64)
+                        count = 64;
+                    for (ix=0; ix<count; ix++)
+                        ubuf[ix] = ((unsigned char *)buf)[lx+ix];
+                    gli_stream_file_put_uni(str, ubuf, count);
                 }
             }
             break;
@@ -1254,19 +1440,19 @@ static glsi32 gli_get_char(stream_t *str, int want_unicode)
                 /* cheap big-endian stream */
                 int res;
                 glui32 ch = 0;
-                res = getc(str->file);
+                res = FILEBUF_GETC(str);
                 if (res == -1)
                     return -1;
                 ch = (res & 0xFF);
-                res = getc(str->file);
+                res = FILEBUF_GETC(str);
                 if (res == -1)
                     return -1;
                 ch = (ch << 8) | (res & 0xFF);
-                res = getc(str->file);
+                res = FILEBUF_GETC(str);
                 if (res == -1)
                     return -1;
                 ch = (ch << 8) | (res & 0xFF);
-                res = getc(str->file);
+                res = FILEBUF_GETC(str);
                 if (res == -1)
                     return -1;
                 ch = (ch << 8) | (res & 0xFF);
@@ -1280,7 +1466,7 @@ static glsi32 gli_get_char(stream_t *str, int want_unicode)
                 glui32 val0, val1, val2, val3;
                 int res;
                 glui32 ch = 0;
-                int flag = UTF8_DECODE_INLINE(&ch, (res=getc(str->file), res == -1), (res & 0xFF), val0, val1, val2, val3);
+                int flag = UTF8_DECODE_INLINE(&ch, (res=FILEBUF_GETC(str), res == -1), (res & 0xFF), val0, val1, val2, val3);
                 if (!flag)
                     return -1;
                 str->readcount++;
@@ -1443,19 +1629,19 @@ static glui32 gli_get_buffer(stream_t *str, char *cbuf, glui32 *ubuf,
                 for (lx=0; lx<len; lx++) {
                     int res;
                     glui32 ch;
-                    res = getc(str->file);
+                    res = FILEBUF_GETC(str);
                     if (res == -1)
                         break;
                     ch = (res & 0xFF);
-                    res = getc(str->file);
+                    res = FILEBUF_GETC(str);
                     if (res == -1)
                         break;
                     ch = (ch << 8) | (res & 0xFF);
-                    res = getc(str->file);
+                    res = FILEBUF_GETC(str);
                     if (res == -1)
                         break;
                     ch = (ch << 8) | (res & 0xFF);
-                    res = getc(str->file);
+                    res = FILEBUF_GETC(str);
                     if (res == -1)
                         break;
                     ch = (ch << 8) | (res & 0xFF);
@@ -1478,7 +1664,7 @@ static glui32 gli_get_buffer(stream_t *str, char *cbuf, glui32 *ubuf,
                     glui32 val0, val1, val2, val3;
                     int res;
                     glui32 ch = 0;
-                    int flag = UTF8_DECODE_INLINE(&ch, (res=getc(str->file), res == -1), (res & 0xFF), val0, val1, val2, val3);
+                    int flag = UTF8_DECODE_INLINE(&ch, (res=FILEBUF_GETC(str), res == -1), (res & 0xFF), val0, val1, val2, val3);
                     if (!flag)
                         break;
                     str->readcount++;
@@ -1682,19 +1868,19 @@ static glui32 gli_get_line(stream_t *str, char *cbuf, glui32 *ubuf,
                 for (lx=0; lx<len && !gotnewline; lx++) {
                     int res;
                     glui32 ch;
-                    res = getc(str->file);
+                    res = FILEBUF_GETC(str);
                     if (res == -1)
                         break;
                     ch = (res & 0xFF);
-                    res = getc(str->file);
+                    res = FILEBUF_GETC(str);
                     if (res == -1)
                         break;
                     ch = (ch << 8) | (res & 0xFF);
-                    res = getc(str->file);
+                    res = FILEBUF_GETC(str);
                     if (res == -1)
                         break;
                     ch = (ch << 8) | (res & 0xFF);
-                    res = getc(str->file);
+                    res = FILEBUF_GETC(str);
                     if (res == -1)
                         break;
                     ch = (ch << 8) | (res & 0xFF);
@@ -1726,7 +1912,7 @@ static glui32 gli_get_line(stream_t *str, char *cbuf, glui32 *ubuf,
                     glui32 val0, val1, val2, val3;
                     int res;
                     glui32 ch = 0;
-                    int flag = UTF8_DECODE_INLINE(&ch, (res=getc(str->file), res == -1), (res & 0xFF), val0, val1, val2, val3);
+                    int flag = UTF8_DECODE_INLINE(&ch, (res=FILEBUF_GETC(str), res == -1), (res & 0xFF), val0, val1, val2, val3);
                     if (!flag)
                         break;
                     str->readcount++;
@@ -1812,55 +1998,39 @@ void glk_put_char_stream_uni(stream_t *str, glui32 ch)
 
 void glk_put_string_uni(glui32 *us)
 {
-    int len = 0;
-    glui32 val;
+    glui32 len = 0;
 
-    while (1) {
-        val = us[len];
-        if (!val)
-            break;
-        gli_put_char_uni(gli_currentstr, val);
+    while (us[len])
         len++;
-    }
+    gli_put_buffer_uni(gli_currentstr, us, len);
 }
 
 void glk_put_string_stream_uni(stream_t *str, glui32 *us)
 {
-    int len = 0;
-    glui32 val;
+    glui32 len = 0;
 
     if (!str) {
         gli_strict_warning("put_string_stream: invalid ref");
         return;
     }
 
-    while (1) {
-        val = us[len];
-        if (!val)
-            break;
-        gli_put_char_uni(str, val);
+    while (us[len])
         len++;
-    }
+    gli_put_buffer_uni(str, us, len);
 }
 
 void glk_put_buffer_uni(glui32 *buf, glui32 len)
 {
-    glui32 ix;
-    for (ix=0; ix<len; ix++) {
-        gli_put_char_uni(gli_currentstr, buf[ix]);
-    }
+    gli_put_buffer_uni(gli_currentstr, buf, len);
 }
 
 void glk_put_buffer_stream_uni(stream_t *str, glui32 *buf, glui32 len)
 {
-    glui32 ix;
     if (!str) {
         gli_strict_warning("put_string_stream: invalid ref");
         return;
     }
-    for (ix=0; ix<len; ix++) {
-        gli_put_char_uni(str, buf[ix]);
-    }
+    gli_put_buffer_uni(str, buf, len);
 }
 
 glsi32 glk_get_char_stream_uni(strid_t str)
@@ -0,0 +1,130 @@
+/* rgtrace.c: Trace-event output
+        for RemGlk, remote-procedure-call implementation of the Glk API.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "glk.h"
+#include "remglk.h"
+
+/* With the -trace option, we record spans of time (waiting for input,
+   building and sending updates, autosave, blorb and file I/O) and write
+   them to a file in the Chrome trace-event format, which chrome://tracing
+   and Perfetto can display.
+
+   Spans go into a fixed-size ring as they finish. The ring is written
+   out when glk_select() has sent its update and is about to wait for
+   input -- the client is busy then, so the time isn't on anyone's
+   critical path -- and at exit. RemGlk is single-threaded, so the ring
+   needs no locking. If it fills up between flushes, further spans are
+   dropped and counted. */
+
+int gli_tracing = FALSE;
+
+typedef struct traceevent_struct {
+    char *name; /* must be static strings */
+    char *cat;
+    unsigned long long start;
+    unsigned long long dur;
+} traceevent_t;
+
+#define TRACE_RING_SIZE (4096)
+
+static traceevent_t tracering[TRACE_RING_SIZE];
+/* Events are added at ringhead and written from ringtail. Both count
+   up forever; the ring position is the count modulo TRACE_RING_SIZE. */
+static glui32 ringhead = 0;
+static glui32 ringtail = 0;
+static glui32 ringdropped = 0;
+
+static FILE *tracefile = NULL;
+static long tracepid = 0;
+static unsigned long long tracebase = 0;
+
+/* Set up the trace file. This is called from main(), if the -trace
+   option was given. */
+void gli_initialize_trace(char *pathname)
+{
+    tracefile = fopen(pathname, "w");
+    if (!tracefile) {
+        gli_strict_warning("unable to open trace file");
+        return;
+    }
+
+    gli_tracing = TRUE;
+    tracepid = (long)getpid();
+    tracebase = gli_trace_now();
+
+    /* The JSON array format. The closing bracket is optional, so a
+       trace from a process that crashed is still readable. */
+    fprintf(tracefile, "[\n{\"name\":\"process_name\", \"ph\":\"M\", \"pid\":%ld, \"tid\":1, \"args\":{\"name\":\"remglk\"}}", tracepid);
+}
+
+/* The current time on the monotonic clock, in nanoseconds. */
+unsigned long long gli_trace_now()
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (unsigned long long)now.tv_sec * 1000000000 + now.tv_nsec;
+}
+
+/* Record a span which started at the given time (from gli_trace_now())
+   and ends now. The name and category must be static strings. */
+void gli_trace_span(char *name, char *cat, unsigned long long start)
+{
+    traceevent_t *ev;
+
+    if (ringhead - ringtail >= TRACE_RING_SIZE) {
+        ringdropped++;
+        return;
+    }
+
+    ev = &(tracering[ringhead % TRACE_RING_SIZE]);
+    ev->name = name;
+    ev->cat = cat;
+    ev->start = start;
+    ev->dur = gli_trace_now() - start;
+    ringhead++;
+}
+
+/* Write out the spans recorded since the last flush. */
+void gli_trace_flush()
+{
+    if (!tracefile)
+        return;
+
+    while (ringtail != ringhead) {
+        traceevent_t *ev = &(tracering[ringtail % TRACE_RING_SIZE]);
+        unsigned long long start = ev->start - tracebase;
+        fprintf(tracefile, ",\n{\"name\":\"%s\", \"cat\":\"%s\", \"ph\":\"X\", \"pid\":%ld, \"tid\":1, \"ts\":%llu.%03d, \"dur\":%llu.%03d}",
+            ev->name, ev->cat, tracepid,
+            start / 1000, (int)(start % 1000),
+            ev->dur / 1000, (int)(ev->dur % 1000));
+        ringtail++;
+    }
+
+    if (ringdropped) {
+        unsigned long long now = gli_trace_now() - tracebase;
+        fprintf(tracefile, ",\n{\"name\":\"dropped\", \"cat\":\"trace\", \"ph\":\"i\", \"s\":\"p\", \"pid\":%ld, \"tid\":1, \"ts\":%llu.%03d, \"args\":{\"count\":%ld}}",
+            tracepid, now / 1000, (int)(now % 1000), (long)ringdropped);
+        ringdropped = 0;
+    }
+
+    fflush(tracefile);
+}
+
+/* Write out everything and close the file. This is called at exit. */
+void gli_trace_finish()
+{
+    if (!gli_tracing)
+        return;
+    gli_tracing = FALSE;
+
+    gli_trace_flush();
+    fprintf(tracefile, "\n]\n");
+    fclose(tracefile);
+    tracefile = NULL;
+}
@@ -19,6 +19,8 @@
 
 static long find_style_by_pos(window_textbuffer_t *dwin, long pos);
 static void set_last_run(window_textbuffer_t *dwin, glui32 style, glui32 hyperlink);
+static void trim_chars(window_textbuffer_t *dwin, long cnum);
+static void win_textbuffer_overflow(window_t *win);
 
 window_textbuffer_t *win_textbuffer_create(window_t *win)
 {
@@ -59,6 +61,9 @@ window_textbuffer_t *win_textbuffer_create(window_t *win)
 
     dwin->updatemark = 0;
     dwin->startclear = FALSE;
+    dwin->elided = 0;
+
+    dwin->deferred = NULL;
     
     dwin->width = -1;
     dwin->height = -1;
@@ -77,6 +82,9 @@ void win_textbuffer_destroy(window_textbuffer_t *dwin)
     }
     
     dwin->owner = NULL;
+
+    if (dwin->deferred)
+        win_textbuffer_discard_deferred(dwin);
     
     if (dwin->runs) {
         free(dwin->runs);
@@ -144,7 +152,14 @@ data_content_t *win_textbuffer_update(window_t *win)
     glui32 curlink;
     long curspecnum;
 
-    if (dwin->updatemark >= dwin->numchars && !dwin->startclear) {
+    /* A deferred window is clean by definition, so we don't need to
+       load it. */
+    if (dwin->deferred) {
+        return NULL;
+    }
+
+    if (dwin->updatemark >= dwin->numchars && !dwin->startclear
+        && !dwin->elided) {
         return NULL;
     }
 
@@ -153,6 +168,20 @@ data_content_t *win_textbuffer_update(window_t *win)
     if (dwin->startclear)
         dat->clear = TRUE;
     
+    if (dwin->elided) {
+        /* Say how much text went missing, on a line of its own. The
+           remaining text starts a new paragraph, too. */
+        char buf[ELIDENOTE_SIZE];
+        int ix, len;
+        len = snprintf(buf, sizeof(buf), "[%ld characters of output omitted]", dwin->elided);
+        for (ix=0; ix<len; ix++)
+            dwin->elidenote[ix] = (unsigned char)buf[ix];
+        data_line_t *line = data_line_alloc();
+        gen_list_append(&dat->lines, line);
+        data_line_add_span(line, style_Note, 0, dwin->elidenote, len);
+        dwin->elided = 0;
+    }
+
     if (TRUE) {
         cnum = dwin->updatemark;
         spanstart = cnum;
@@ -167,7 +196,7 @@ data_content_t *win_textbuffer_update(window_t *win)
 
         data_line_t *line = data_line_alloc();
         gen_list_append(&dat->lines, line);
-        line->append = TRUE;
+        line->append = (dat->lines.count == 1);
 
         while (cnum < dwin->numchars) {
             glui32 ch = dwin->chars[cnum];
@@ -239,6 +268,8 @@ void win_textbuffer_putchar(window_t *win, glui32 ch)
 {
     window_textbuffer_t *dwin = win->data;
     long lx;
+
+    win_textbuffer_ensure_loaded(dwin);
     
     if (dwin->numchars >= dwin->charssize) {
         dwin->charssize *= 2;
@@ -256,6 +287,9 @@ void win_textbuffer_putchar(window_t *win, glui32 ch)
     
     dwin->chars[lx] = ch;
     dwin->numchars++;
+
+    if (pref_turnchars && dwin->numchars - dwin->updatemark > pref_turnchars)
+        win_textbuffer_overflow(win);
 }
 
 void win_textbuffer_putspecial(window_t *win, data_specialspan_t *special)
@@ -265,6 +299,8 @@ void win_textbuffer_putspecial(window_t *win, data_specialspan_t *special)
 
     window_textbuffer_t *dwin = win->data;
     long lx, px;
+
+    win_textbuffer_ensure_loaded(dwin);
     
     if (dwin->numchars >= dwin->charssize) {
         dwin->charssize *= 2;
@@ -291,6 +327,9 @@ void win_textbuffer_putspecial(window_t *win, data_specialspan_t *special)
     
     dwin->chars[lx] = '#';  /* dummy char (not a newline!) */
     dwin->numchars++;
+
+    if (pref_turnchars && dwin->numchars - dwin->updatemark > pref_turnchars)
+        win_textbuffer_overflow(win);
 }
 
 /* If the last (dangling) run is empty, set its style/link attributes.
@@ -326,6 +365,10 @@ void win_textbuffer_clear(window_t *win)
     window_textbuffer_t *dwin = win->data;
     long px;
 
+    /* No point decoding text that we're about to throw away. */
+    if (dwin->deferred)
+        win_textbuffer_discard_deferred(dwin);
+
     for (px=0; px<dwin->numspecials; px++) {
         data_specialspan_free(dwin->specials[px]);
         dwin->specials[px] = NULL;
@@ -342,13 +385,17 @@ void win_textbuffer_clear(window_t *win)
     
     dwin->updatemark = 0;
     dwin->startclear = TRUE;
+    dwin->elided = 0;
 }
 
 void win_textbuffer_trim_buffer(window_t *win)
 {
     window_textbuffer_t *dwin = win->data;
-    long snum, cnum, specnum;
-    long rx, px;
+    long cnum;
+
+    /* Deferred text was trimmed before it was saved. */
+    if (dwin->deferred)
+        return;
     
     if (dwin->numchars <= BUFFER_SIZE + BUFFER_SLACK)
         return; 
@@ -367,6 +414,48 @@ void win_textbuffer_trim_buffer(window_t *win)
     if (cnum <= 0)
         return;
 
+    trim_chars(dwin, cnum);
+}
+
+/* More than pref_turnchars characters have piled up since the last
+   update. If the client accepts partial updates, send what we have, and
+   then trim the window as usual. If not, throw away the oldest unsent
+   paragraphs, down to half the limit; the next update will note how
+   much is missing. Either way, a game which prints without end can't
+   use up all our memory before it gets around to glk_select(). */
+static void win_textbuffer_overflow(window_t *win)
+{
+    window_textbuffer_t *dwin = win->data;
+    long cnum, target;
+
+    if (gli_supportcaps.partialupdates
+        || (gli_fastforwarding && data_fastforward_pending())) {
+        gli_windows_update_partial();
+        win_textbuffer_trim_buffer(win);
+        return;
+    }
+
+    target = dwin->numchars - pref_turnchars / 2;
+
+    /* Back up to the start of a paragraph, unless the whole lot is one
+       giant paragraph. */
+    cnum = target;
+    while (cnum > dwin->updatemark && dwin->chars[cnum-1] != '\n')
+        cnum--;
+    if (cnum <= dwin->updatemark)
+        cnum = target;
+
+    dwin->elided += (cnum - dwin->updatemark);
+    trim_chars(dwin, cnum);
+}
+
+/* Remove the first cnum characters of the window, along with their
+   styleruns and specials. */
+static void trim_chars(window_textbuffer_t *dwin, long cnum)
+{
+    long snum, specnum;
+    long rx, px;
+
     /* Find the first stylerun that we will save. */
     snum = find_style_by_pos(dwin, cnum);
 
@@ -388,8 +477,11 @@ void win_textbuffer_trim_buffer(window_t *win)
             (dwin->numchars - cnum) * sizeof(glui32));
     dwin->numchars -= cnum;
 
-    /* We already know that updatemark >= cnum. */
-    dwin->updatemark -= cnum;
+    /* Unsent characters may be going too, if we're eliding. */
+    if (dwin->updatemark > cnum)
+        dwin->updatemark -= cnum;
+    else
+        dwin->updatemark = 0;
 
     /* trim specials */
 
@@ -437,6 +529,8 @@ void win_textbuffer_init_line(window_t *win, void *buf, int unicode,
     int maxlen, int initlen)
 {
     window_textbuffer_t *dwin = win->data;
+
+    win_textbuffer_ensure_loaded(dwin);
     
     dwin->inbuf = buf;
     dwin->inunicode = unicode;
@@ -497,6 +591,8 @@ void win_textbuffer_accept_line(window_t *win)
     
     if (!dwin->inbuf)
         return;
+
+    win_textbuffer_ensure_loaded(dwin);
     
     inbuf = dwin->inbuf;
     inmax = dwin->inmax;
@@ -564,6 +660,8 @@ void win_textbuffer_cancel_line(window_t *win, event_t *ev)
     if (!dwin->inbuf)
         return;
 
+    win_textbuffer_ensure_loaded(dwin);
+
     inbuf = dwin->inbuf;
     inmax = dwin->inmax;
     inarrayrock = dwin->inarrayrock;
@@ -4,6 +4,8 @@
     http://eblong.com/zarf/glk/
 */
 
+#define ELIDENOTE_SIZE (64)
+
 /* One style/link run */
 typedef struct tbrun_struct {
     short style;
@@ -27,11 +29,20 @@ typedef struct window_textbuffer_struct {
     
     long updatemark;
     int startclear;
+    long elided; /* unsent characters thrown away because of -turnchars */
+    /* The note which stands in for elided text. The update refers to
+       this, so it has to be kept until the update is printed. */
+    glui32 elidenote[ELIDENOTE_SIZE];
     
     tbrun_t *runs; /* There is always at least one run. */
     long numruns;
     long runssize;
 
+    /* After autorestore, the chars/runs/specials are left in their
+       serialized form until something needs them. While this is set,
+       the window is clean (updatemark == numchars). */
+    data_raw_t *deferred;
+
     /* The following are meaningful only for the current line input request. */
     /* Note that inbuf points to memory outside the library. Usually it's owned by the dispatch layer. */
     void *inbuf; /* char* or glui32*, depending on inunicode. */
@@ -61,3 +72,10 @@ extern void win_textbuffer_prepare_input(window_t *win, glui32 *buf, glui32 len)
 extern void win_textbuffer_accept_line(window_t *win);
 extern void win_textbuffer_cancel_line(window_t *win, event_t *ev);
 
+/* These are implemented in rgauto.c. */
+extern void win_textbuffer_load_deferred(window_textbuffer_t *dwin);
+extern void win_textbuffer_discard_deferred(window_textbuffer_t *dwin);
+
+#define win_textbuffer_ensure_loaded(dwin)  \
+    ((dwin)->deferred ? win_textbuffer_load_deferred(dwin) : (void)0)
+
@@ -39,10 +39,26 @@ window_t *gli_rootwin = NULL; /* The topmost window. */
 static data_metrics_t metrics;
 /* Flag: Has the window arrangement changed at all? */
 static int geometry_changed;
+/* Flag: Has it changed in a way that needs the whole window list to be
+   sent? (A window was closed, say.) If not, a client which supports
+   partial window lists only gets the windows whose geometry_dirty flag
+   is set. */
+static int geometry_allchanged;
 
 void (*gli_interrupt_handler)(void) = NULL;
 
+/* Set while sending a partial update (see gli_windows_update_partial). */
+static int partialupdate = FALSE;
+
+/* Which windows the client wants content for. NULL means all of them. */
+static data_subscription_t *subscription = NULL;
+
 static void compute_content_box(grect_t *box);
+static void windows_mark_clean(void);
+static void window_mark_clean(window_t *win);
+static void window_refresh(window_t *win);
+static int window_subscribed(data_subscription_t *sub, window_t *win);
+static void window_grid_size(window_t *win, glui32 *width, glui32 *height);
 
 /* Set up the window system. This is called from main(). */
 void gli_initialize_windows()
@@ -51,7 +67,10 @@ void gli_initialize_windows()
 
     generation = 0;
     srandom(time(NULL));
-    tagcounter = (random() % 15) + 16;
+    if (pref_windowbase > 0)
+        tagcounter = pref_windowbase;
+    else
+        tagcounter = (random() % 15) + 16;
     gli_rootwin = NULL;
     
     /* Build a convenient array of spaces. */
@@ -62,6 +81,7 @@ void gli_initialize_windows()
     memset(&metrics, 0, sizeof(metrics));
 
     geometry_changed = TRUE;
+    geometry_allchanged = TRUE;
 }
 
 /* Get out fast. This is used by the ctrl-C interrupt handler, under Unix. 
@@ -75,6 +95,15 @@ void gli_fast_exit()
     }
 
     gli_streams_close_all();
+
+    if (gli_turnstats)
+        gli_turnstats_finish();
+    if (gli_tracing)
+        gli_trace_finish();
+#ifdef GI_DISPA_PROFILE
+    gli_profile_write();
+#endif /* GI_DISPA_PROFILE */
+
     exit(0);
 }
 
@@ -126,6 +155,7 @@ window_t *gli_new_window(glui32 type, glui32 rock)
     win->parent = NULL; /* for now */
     win->data = NULL; /* for now */
     data_grect_clear(&win->bbox);
+    win->geometry_dirty = TRUE;
     win->inputgen = 0;
     win->char_request = FALSE;
     win->line_request = FALSE;
@@ -170,6 +200,7 @@ window_t *gli_window_alloc_inactive()
     win->parent = NULL;
     win->data = NULL;
     data_grect_clear(&win->bbox);
+    win->geometry_dirty = TRUE;
     win->inputgen = 0;
     win->char_request = FALSE;
     win->line_request = FALSE;
@@ -241,6 +272,10 @@ void gli_delete_window(window_t *win)
 {
     window_t *prev, *next;
     
+    /* A partial window list can't say that a window is gone. */
+    geometry_changed = TRUE;
+    geometry_allchanged = TRUE;
+
     if (gli_unregister_obj)
         (*gli_unregister_obj)(win, gidisp_Class_Window, win->disprock);
         
@@ -371,6 +406,9 @@ int gli_windows_update_from_state(window_t **list, int count, window_t *rootwin,
     gli_rootwin = rootwin;
     generation = gen;
     geometry_changed = FALSE;
+    geometry_allchanged = FALSE;
+    for (ix=0; ix<count; ix++)
+        list[ix]->geometry_dirty = FALSE;
 
     return TRUE;
 }
@@ -562,6 +600,7 @@ void glk_window_close(window_t *win, stream_result_t *result)
         
         /* begin (simpler) closation */
         geometry_changed = TRUE;
+        geometry_allchanged = TRUE;
         
         gli_stream_fill_result(win->str, result);
         gli_window_close(win, TRUE); 
@@ -1011,44 +1050,90 @@ void gidebug_output(char *text)
 
    If special is provided, it goes into the update. It will be freed
    after sending.
+
+   While -fastforward input is queued up, nobody is waiting for the
+   update, so we skip it and just clear the dirty flags. When the queue
+   runs out, the client has seen nothing at all, so we send everything.
 */
 void gli_windows_update(data_specialreq_t *special, int newgeneration, int gameover)
 {
     window_t *win;
     int ix;
-    data_update_t *update = data_update_alloc();
+    data_update_t *update;
+    int resumecompute = FALSE;
+    unsigned long long tracestart = 0;
+
+    /* Any events still queued from the client's last list were sent
+       with the old generation number. */
+    if (newgeneration)
+        data_event_discard_queued();
+
+    if (gli_fastforwarding) {
+        if (!gameover && data_fastforward_pending()) {
+            if (newgeneration)
+                generation++;
+            windows_mark_clean();
+            if (special)
+                data_specialreq_free(special);
+            return;
+        }
+        gli_fastforwarding = FALSE;
+        gli_windows_refresh(0);
+        geometry_changed = TRUE;
+        geometry_allchanged = TRUE;
+    }
+
+    if (gli_tracing)
+        tracestart = gli_trace_now();
+
+    if (gli_turnstats) {
+        /* If this happens in the middle of the game's computation (a
+           file prompt, say), take it out of the compute time. */
+        resumecompute = gli_turnstats_switch(gli_phase_Compute, gli_phase_Build);
+        if (!resumecompute)
+            gli_turnstats_begin(gli_phase_Build);
+    }
+
+    update = data_update_alloc();
 
     if (newgeneration)
         generation++;
     update->gen = generation;
 
     if (geometry_changed) {
+        int partial = (gli_supportcaps.partialwindows && !geometry_allchanged);
         geometry_changed = FALSE;
+        geometry_allchanged = FALSE;
 
         update->usewindows = TRUE;
+        update->partialwindows = partial;
 
         for (win=gli_windowlist, ix=0; win; win=win->next, ix++) {
+            int dirty = win->geometry_dirty;
+            win->geometry_dirty = FALSE;
             if (win->type == wintype_Pair)
                 continue;
+            if (partial && !dirty)
+                continue;
             data_window_t *dat = data_window_alloc(win->updatetag,
                 win->type, win->rock);
             dat->size = win->bbox;
-            if (win->type == wintype_TextGrid) {
-                window_textgrid_t *dwin = win->data;
-                dat->gridwidth = dwin->width;
-                dat->gridheight = dwin->height;
-            }
-            if (win->type == wintype_Graphics) {
-                window_graphics_t *dwin = win->data;
-                dat->gridwidth = dwin->graphwidth;
-                dat->gridheight = dwin->graphheight;
-            }
+            window_grid_size(win, &dat->gridwidth, &dat->gridheight);
             gen_list_append(&update->windows, dat);
         }
+
+        if (partial && !update->windows.count)
+            update->usewindows = FALSE;
     }
     
     for (win=gli_windowlist; win; win=win->next) {
         data_content_t *dat = NULL;
+        if (subscription && !window_subscribed(subscription, win)) {
+            /* The client doesn't want to see this, but we still clear
+               the dirty state, so that trimming works. */
+            window_mark_clean(win);
+            continue;
+        }
         switch (win->type) {
             case wintype_TextGrid:
                 dat = win_textgrid_update(win);
@@ -1132,6 +1217,8 @@ void gli_windows_update(data_specialreq_t *special, int newgeneration, int gameo
 
     if (gameover)
         update->exit = TRUE;
+    if (partialupdate)
+        update->partial = TRUE;
 
 #if GIDEBUG_LIBRARY_SUPPORT
     for (ix=0; ix<debug_output_cache.count; ix++) {
@@ -1141,11 +1228,40 @@ void gli_windows_update(data_specialreq_t *special, int newgeneration, int gameo
     debug_output_cache.count = 0;
 #endif /* GIDEBUG_LIBRARY_SUPPORT */
 
+    if (gli_turnstats)
+        gli_turnstats_switch(gli_phase_Build, gli_phase_Serialize);
+    if (gli_tracing) {
+        gli_trace_span("build", "update", tracestart);
+        tracestart = gli_trace_now();
+    }
     data_update_print(update);
-    printf("\n"); /* blank line after stanza */
+    data_stanza_end();
+    if (gli_turnstats)
+        gli_turnstats_switch(gli_phase_Serialize, gli_phase_Flush);
     fflush(stdout);
+    if (gli_tracing)
+        gli_trace_span("serialize", "update", tracestart);
+    if (gli_turnstats)
+        gli_turnstats_switch(gli_phase_Flush, gli_phase_Build);
 
     data_update_free(update);
+    if (gli_turnstats) {
+        gli_turnstats_end(gli_phase_Build);
+        if (resumecompute)
+            gli_turnstats_begin(gli_phase_Compute);
+    }
+}
+
+/* Send an update in the middle of a turn, because a buffer window has
+   more than pref_turnchars characters of unsent text. This keeps the
+   current generation number, and is marked partial; the client should
+   display it and keep waiting. (Only sent if the client declared the
+   "partialupdates" capability.) */
+void gli_windows_update_partial()
+{
+    partialupdate = TRUE;
+    gli_windows_update(NULL, FALSE, FALSE);
+    partialupdate = FALSE;
 }
 
 /* Set dirty flags on everything, as if the client hasn't seen any
@@ -1157,20 +1273,131 @@ void gli_windows_update(data_specialreq_t *special, int newgeneration, int gameo
 void gli_windows_refresh(glui32 fromgen)
 {
     window_t *win;
-    for (win=gli_windowlist; win; win=win->next) {
-        if (win->type == wintype_TextBuffer) {
-            window_textbuffer_t *dwin = win->data;
-            dwin->updatemark = 0;
-        }
-        else if (win->type == wintype_TextGrid) {
-            window_textgrid_t *dwin = win->data;
-            dwin->alldirty = TRUE;
+    for (win=gli_windowlist; win; win=win->next)
+        window_refresh(win);
+}
+
+static void window_refresh(window_t *win)
+{
+    if (win->type == wintype_TextBuffer) {
+        window_textbuffer_t *dwin = win->data;
+        win_textbuffer_ensure_loaded(dwin);
+        dwin->updatemark = 0;
+    }
+    else if (win->type == wintype_TextGrid) {
+        window_textgrid_t *dwin = win->data;
+        dwin->alldirty = TRUE;
+    }
+    else if (win->type == wintype_Graphics) {
+        window_graphics_t *dwin = win->data;
+        dwin->updatemark = 0;
+    }
+}
+
+/* Clear dirty flags on everything, as if an update had been sent. The
+   window contents are left alone, so trimming works as usual. */
+static void windows_mark_clean()
+{
+    window_t *win;
+
+    geometry_changed = FALSE;
+    geometry_allchanged = FALSE;
+
+    for (win=gli_windowlist; win; win=win->next)
+        window_mark_clean(win);
+}
+
+static void window_mark_clean(window_t *win)
+{
+    int jx;
+
+    win->geometry_dirty = FALSE;
+
+    if (win->type == wintype_TextBuffer) {
+        window_textbuffer_t *dwin = win->data;
+        if (dwin->deferred)
+            return;
+        dwin->updatemark = dwin->numchars;
+        dwin->startclear = FALSE;
+    }
+    else if (win->type == wintype_TextGrid) {
+        window_textgrid_t *dwin = win->data;
+        if (dwin->lines) {
+            for (jx=0; jx<dwin->height; jx++)
+                dwin->lines[jx].dirty = FALSE;
         }
-        else if (win->type == wintype_Graphics) {
-            window_graphics_t *dwin = win->data;
-            dwin->updatemark = 0;
+        dwin->alldirty = FALSE;
+    }
+    else if (win->type == wintype_Graphics) {
+        window_graphics_t *dwin = win->data;
+        dwin->updatemark = dwin->numcontent;
+    }
+}
+
+static int window_subscribed(data_subscription_t *sub, window_t *win)
+{
+    int ix;
+
+    if (!sub)
+        return TRUE;
+
+    switch (win->type) {
+        case wintype_TextBuffer:
+            if (sub->buffer)
+                return TRUE;
+            break;
+        case wintype_TextGrid:
+            if (sub->grid)
+                return TRUE;
+            break;
+        case wintype_Graphics:
+            if (sub->graphics)
+                return TRUE;
+            break;
+    }
+
+    for (ix=0; ix<sub->numids; ix++) {
+        if (sub->ids[ix] == win->updatetag)
+            return TRUE;
+    }
+    return FALSE;
+}
+
+/* Change which windows the client wants content for. This takes
+   ownership of the subscription object. A window which was left out
+   before, and is now wanted, is sent in full in the next update. (The
+   client may have stale content for it from an earlier subscription,
+   so buffer windows are cleared first.) */
+void gli_windows_subscribe(data_subscription_t *newsub)
+{
+    window_t *win;
+    data_subscription_t *oldsub = subscription;
+
+    if (newsub->all) {
+        data_subscription_free(newsub);
+        newsub = NULL;
+    }
+
+    for (win=gli_windowlist; win; win=win->next) {
+        if (!window_subscribed(oldsub, win) && window_subscribed(newsub, win)) {
+            window_refresh(win);
+            if (win->type == wintype_TextBuffer) {
+                window_textbuffer_t *dwin = win->data;
+                dwin->startclear = TRUE;
+            }
         }
     }
+
+    subscription = newsub;
+    if (oldsub)
+        data_subscription_free(oldsub);
+}
+
+/* Returns the current subscription, or NULL if the client wants every
+   window. */
+data_subscription_t *gli_windows_get_subscription()
+{
+    return subscription;
 }
 
 /* Some trivial switch functions which make up for the fact that we're not
@@ -1178,6 +1405,10 @@ void gli_windows_refresh(glui32 fromgen)
 
 void gli_window_rearrange(window_t *win, grect_t *box, data_metrics_t *metrics)
 {
+    grect_t oldbox = win->bbox;
+    glui32 oldwidth, oldheight, newwidth, newheight;
+
+    window_grid_size(win, &oldwidth, &oldheight);
     geometry_changed = TRUE;
 
     switch (win->type) {
@@ -1197,6 +1428,31 @@ void gli_window_rearrange(window_t *win, grect_t *box, data_metrics_t *metrics)
             win_graphics_rearrange(win, box, metrics);
             break;
     }
+
+    window_grid_size(win, &newwidth, &newheight);
+    if (oldbox.left != win->bbox.left || oldbox.top != win->bbox.top
+        || oldbox.right != win->bbox.right || oldbox.bottom != win->bbox.bottom
+        || oldwidth != newwidth || oldheight != newheight)
+        win->geometry_dirty = TRUE;
+}
+
+/* The size of a grid window in characters, or a graphics window in
+   pixels. For other windows, zero. */
+static void window_grid_size(window_t *win, glui32 *width, glui32 *height)
+{
+    *width = 0;
+    *height = 0;
+
+    if (win->type == wintype_TextGrid) {
+        window_textgrid_t *dwin = win->data;
+        *width = dwin->width;
+        *height = dwin->height;
+    }
+    else if (win->type == wintype_Graphics) {
+        window_graphics_t *dwin = win->data;
+        *width = dwin->graphwidth;
+        *height = dwin->graphheight;
+    }
 }
 
 void gli_window_prepare_input(window_t *win, glui32 *buf, glui32 len)
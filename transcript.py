@@ -0,0 +1,206 @@
+#!/usr/bin/env python3
+
+# Record a RemGlk session, and replay it later against another build.
+#
+#   python3 transcript.py record FILE -- game [args ...]
+#   python3 transcript.py replay FILE [--prog game]
+#
+# In record mode, this script sits between the client and the game. It
+# passes the client's input to the game and the game's output back to
+# the client, untouched, and logs both to FILE with timestamps. The
+# input is exactly what the library reads on stdin -- that is, what
+# data_event_read() consumes. Put "transcript.py record FILE --" in
+# front of the game command wherever your server launches it.
+#
+# In replay mode, it runs the game again, feeds it the recorded input as
+# fast as the game will take it, and checks that the output matches the
+# recording byte for byte. It reports the throughput and the latency of
+# each input (from sending it to receiving all the output that followed
+# it in the recording). Exit status is 1 if the output differs.
+#
+# Window ids are normally random, so record mode adds "-windowbase NUM"
+# to the game's arguments, and replay passes the same value. A game
+# whose output depends on the time, or on a random number generator,
+# won't replay exactly unless it can be made deterministic the same way.
+#
+# The transcript is JSON, one object per line. The first line is a
+# header with the command and window base. Each following line has a
+# time in seconds from the start ("t") and a chunk of text which was
+# either read by the game ("in") or written by it ("out"). The text is
+# decoded as Latin-1, so every byte survives as one character. If the
+# client closed its end of stdin, an "eof" line marks when.
+
+import sys
+import os
+import json
+import time
+import random
+import selectors
+import optparse
+import subprocess
+
+def record(path, command):
+    windowbase = random.randrange(16, 31)
+    command = [ command[0], '-windowbase', str(windowbase) ] + command[1:]
+    proc = subprocess.Popen(command, stdin=subprocess.PIPE, stdout=subprocess.PIPE)
+
+    outfl = open(path, 'w')
+    header = { 'transcript':1, 'command':command, 'windowbase':windowbase }
+    outfl.write(json.dumps(header) + '\n')
+    starttime = time.monotonic()
+
+    def log(key, data):
+        entry = { 't':round(time.monotonic() - starttime, 6), key:data.decode('latin-1') }
+        outfl.write(json.dumps(entry) + '\n')
+
+    clientin = sys.stdin.fileno()
+    clientout = sys.stdout.fileno()
+    gamein = proc.stdin.fileno()
+    gameout = proc.stdout.fileno()
+
+    sel = selectors.DefaultSelector()
+    sel.register(clientin, selectors.EVENT_READ)
+    sel.register(gameout, selectors.EVENT_READ)
+
+    done = False
+    while not done:
+        for (key, events) in sel.select():
+            data = os.read(key.fd, 65536)
+            if key.fd == clientin:
+                if not data:
+                    sel.unregister(clientin)
+                    outfl.write(json.dumps({ 't':round(time.monotonic() - starttime, 6), 'eof':True }) + '\n')
+                    proc.stdin.close()
+                    continue
+                log('in', data)
+                os.write(gamein, data)
+            else:
+                if not data:
+                    done = True
+                    break
+                log('out', data)
+                os.write(clientout, data)
+
+    outfl.close()
+    return proc.wait()
+
+def percentile(vals, pc):
+    """Nearest-rank percentile of a sorted list."""
+    pos = (len(vals) * pc + 99) // 100
+    return vals[max(pos, 1) - 1]
+
+def replay(path, prog, timeout):
+    infl = open(path)
+    header = json.loads(infl.readline())
+    if header.get('transcript') != 1:
+        raise Exception('not a transcript file: ' + path)
+    entries = [ json.loads(ln) for ln in infl ]
+    infl.close()
+
+    command = list(header['command'])
+    if prog:
+        command[0] = prog
+    proc = subprocess.Popen(command, stdin=subprocess.PIPE, stdout=subprocess.PIPE)
+    gameout = proc.stdout.fileno()
+    sel = selectors.DefaultSelector()
+    sel.register(gameout, selectors.EVENT_READ)
+
+    def read_exactly(count):
+        """Read count bytes of output, or fewer if the game stops or
+        stalls."""
+        res = bytearray()
+        while len(res) < count:
+            if not sel.select(timeout):
+                break
+            data = os.read(gameout, count - len(res))
+            if not data:
+                break
+            res.extend(data)
+        return bytes(res)
+
+    latencies = []
+    numinputs = 0
+    outpos = 0
+    mismatch = None
+    lastsent = None
+    starttime = time.monotonic()
+
+    for entry in entries:
+        if 'in' in entry or 'eof' in entry:
+            if lastsent is not None:
+                latencies.append(time.monotonic() - lastsent)
+                lastsent = None
+            if 'eof' in entry:
+                proc.stdin.close()
+                continue
+            proc.stdin.write(entry['in'].encode('latin-1'))
+            proc.stdin.flush()
+            lastsent = time.monotonic()
+            numinputs += 1
+        else:
+            expected = entry['out'].encode('latin-1')
+            got = read_exactly(len(expected))
+            if got != expected:
+                ix = 0
+                while ix < len(got) and got[ix] == expected[ix]:
+                    ix += 1
+                mismatch = (outpos + ix, expected[ix:ix+60], got[ix:ix+60])
+                break
+            outpos += len(expected)
+
+    if mismatch is None:
+        if lastsent is not None:
+            latencies.append(time.monotonic() - lastsent)
+        # There should be nothing more.
+        extra = read_exactly(1)
+        if extra:
+            mismatch = (outpos, b'', extra)
+
+    elapsed = time.monotonic() - starttime
+    proc.kill()
+    proc.wait()
+
+    recorded = (entries[-1]['t'] if entries else 0)
+    print('inputs:      %d' % (numinputs,))
+    print('output:      %d bytes matched' % (outpos,))
+    print('replay time: %.3f s (recorded session: %.3f s)' % (elapsed, recorded))
+    if elapsed > 0:
+        print('throughput:  %.1f inputs/sec' % (numinputs / elapsed,))
+    if latencies:
+        latencies.sort()
+        print('latency:     p50 %.3f ms, p90 %.3f ms, p99 %.3f ms, max %.3f ms' % (
+            1000*percentile(latencies, 50), 1000*percentile(latencies, 90),
+            1000*percentile(latencies, 99), 1000*latencies[-1]))
+
+    if mismatch is not None:
+        (pos, expected, got) = mismatch
+        print('MISMATCH at output byte %d' % (pos,))
+        print('  expected: %r' % (expected,))
+        print('  got:      %r' % (got,))
+        return 1
+    print('output matches')
+    return 0
+
+popt = optparse.OptionParser(usage='transcript.py record FILE -- game [args ...]\n       transcript.py replay FILE [--prog game]')
+popt.add_option('--prog', action='store', dest='prog',
+                help='(replay) program to run, in place of the recorded one')
+popt.add_option('--timeout', action='store', type=float, dest='timeout', default=10.0,
+                help='(replay) seconds to wait for expected output (default 10)')
+
+(opts, args) = popt.parse_args()
+
+if len(args) < 2:
+    popt.print_usage()
+    sys.exit(2)
+
+if args[0] == 'record':
+    command = args[2:]
+    if command and command[0] == '--':
+        command = command[1:]
+    if not command:
+        popt.error('no game command given')
+    sys.exit(record(args[1], command))
+elif args[0] == 'replay':
+    sys.exit(replay(args[1], opts.prog, opts.timeout))
+else:
+    popt.error('unknown mode: ' + args[0])